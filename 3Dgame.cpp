@@ -1,11 +1,26 @@
 #include <iostream>
 #include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
 #include <fstream>
+#include <sstream>
 #include <vector>
+#include <map>
+#include <string>
+#include <algorithm>
+#include <new>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+// glad.c: resolves an extension that the trimmed loader skipped at startup
+extern "C" int gladLoadGLExtension(const char *ext);
+
 #define GLM_FORCE_RADIANS
 #include <glm/glm.hpp>
 #include <glm/gtx/transform.hpp>
@@ -13,21 +28,119 @@
 
 using namespace std;
 
-double player_x_coordinate=-2.0,player_y_coordinate=-2.0,player_z_coordinate=0.0;
 double eye_x=0,eye_y=0,eye_z=3;
-double playerJump=0;
 int player_level=0;
-double blockMove=0,onBlock=0;
-// array of holes
+double blockMove=0;
+
+// Everything that moves on the board: the player is entity 0, the rest are
+// wandering agents. Stored as a structure of arrays so the update loops run
+// over contiguous floats and vectorize.
+struct Entities {
+    int count;
+    vector<float> x, y, z;      // position
+    vector<float> vx, vy;       // horizontal velocity in units/s
+    vector<float> jump;         // remaining jump in game ticks, 0 when not jumping
+    vector<float> jump_base;    // height the current jump started from
+    vector<float> on_block;     // 1 once the entity has landed on a moving block
+} entities;
+const int PLAYER=0;
+// --agents N: number of agents spawned besides the player
+int agent_count=0;
+
+// board is board_width x board_height tiles, 0.5 units apart starting at (-2,-2)
+int board_width=10, board_height=10;
+// half the edge length of the tile and player cubes
+const double TILE_HALF_SIZE=0.2, PLAYER_HALF_SIZE=0.2;
+// draw the whole board with one instanced call instead of one call per tile
+bool instanced_grid=false;
+// --merged: draw each chunk as one mesh without hidden faces, coarser when far away
+bool merged_chunks=false;
+// --greedy-floor: draw the static tiles as one mesh of merged quads, built at level load
+bool greedy_floor=false;
+// skip board regions outside the camera frustum
+bool frustum_culling=true;
+// --bench N: render N frames in a hidden window with vsync off, then report timings
+int bench_frames=0;
+// collect per-frame timings, summarized on exit; --trace also writes them to a file
+bool profiling=false;
+const char* trace_path=NULL;
+// fixed simulation step rate, independent of the render rate
+double sim_hz=120;
+// how frames are presented: --present vsync|adaptive|uncapped, --fps-limit FPS
+enum PresentMode { PRESENT_DEFAULT, PRESENT_VSYNC, PRESENT_ADAPTIVE, PRESENT_UNCAPPED };
+PresentMode present_mode=PRESENT_DEFAULT;
+double fps_limit=0;
+// --sim-thread: step the simulation on a worker thread instead of in the render loop
+bool sim_threaded=false;
+// seconds per step of the original game rules; jump/block speeds are defined per tick
+const double GAME_TICK=0.5;
+
+/* Simulated values the renderer draws, interpolated between the last two steps */
+struct RenderState {
+    long step;                  // simulation step the state leads up to
+    double block_move;
+    vector<float> x, y, z;      // entity positions
+} render_state;
+
+struct AABB {
+    double min_x, min_y, min_z;
+    double max_x, max_y, max_z;
+};
+
+// level: one tile type per board cell, indexed by tileIndex(i,j)
+enum TileType { TILE_FLOOR = 0, TILE_HOLE = 1, TILE_MOVING = 2 };
+vector<unsigned char> tiles;
+vector<int> movingTiles;    // tile indices of the moving blocks, for per-frame updates
+
+/* How one vertex attribute is stored in its VBO */
+struct VertexAttrib {
+    GLuint Index;           // shader location: 0 position, 1 color, 2 instance offset
+    GLint Size;             // components
+    GLenum Type;
+    GLboolean Normalized;
+    int Offset;             // bytes from the start of the vertex
+};
+
+/* Interleaved vertex layout: every attribute of a vertex packed into Stride bytes */
+struct VertexLayout {
+    const char* Name;
+    int Stride;
+    int NumAttribs;
+    VertexAttrib Attribs[2];
+};
+
+// position as float, half or snorm16, color always normalized RGBA8
+enum VertexFormat { VERTEX_FLOAT, VERTEX_HALF, VERTEX_SNORM16 };
+const VertexLayout vertexLayouts[] = {
+    { "float",   16, 2, { { 0, 3, GL_FLOAT,      GL_FALSE, 0 }, { 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 12 } } },
+    // 2 bytes of padding after the half/snorm position keep the color 4-byte aligned
+    { "half",    12, 2, { { 0, 3, GL_HALF_FLOAT, GL_FALSE, 0 }, { 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 8 } } },
+    // snorm16 positions must lie in [-1,1]; values outside are clamped
+    { "snorm16", 12, 2, { { 0, 3, GL_SHORT,      GL_TRUE,  0 }, { 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 8 } } },
+};
+VertexFormat vertex_format=VERTEX_FLOAT;
+
+// color stream of objects that share another object's positions
+const VertexLayout colorOnlyLayout = { "color", 4, 1, { { 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0 } } };
+const VertexAttrib instanceOffsetAttrib = { 2, 3, GL_FLOAT, GL_FALSE, 0 };
+
+struct Arena;
 
 struct VAO {
+    struct Arena* Owner;    // arena deleting the GL objects, NULL if the creator does
     GLuint VertexArrayID;
     GLuint VertexBuffer;
-    GLuint ColorBuffer;
+    GLuint ColorBuffer;     // separate color VBO, 0 if colors are interleaved
+    GLuint IndexBuffer;     // element indices, 0 if drawn unindexed
+    GLuint InstanceBuffer;  // per-instance offsets, 0 if not instanced
 
     GLenum PrimitiveMode;
     GLenum FillMode;
+    GLenum IndexType;
+    const VertexLayout* Layout;
     int NumVertices;
+    int NumIndices;
+    int NumInstances;
 };
 typedef struct VAO VAO;
 
@@ -35,39 +148,142 @@ struct GLMatrices {
 	glm::mat4 projection;
 	glm::mat4 model;
 	glm::mat4 view;
-	GLuint MatrixID;
+	GLuint OffsetID;    // "modelOffset" uniform of the per-object program
 } Matrices;
 
-GLuint programID, fontProgramID, textureProgramID;
+// View-projection matrix shared by every program through one uniform buffer,
+// re-uploaded only when the camera moves
+const GLuint CAMERA_BINDING = 0;
+GLuint cameraUBO;
+glm::mat4 cameraVP;
+bool cameraValid = false;
+
+GLuint programID, instancedProgramID, fontProgramID, textureProgramID;
+
+/*****************
+ * Program cache *
+ *****************/
+
+// Linked program binaries are kept in this directory, one file per program,
+// named by a hash of the shader sources and the GL driver
+const char* SHADER_CACHE_DIR = "shader_cache";
+const char PROGRAM_CACHE_MAGIC[4] = { 'G', 'L', 'P', 'B' };
+
+/* Read a whole file in one go, empty if it can't be opened */
+std::string readFile(const char* path)
+{
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    std::ostringstream contents;
+    if (in.is_open())
+        contents << in.rdbuf();
+    return contents.str();
+}
+
+/* 64-bit FNV-1a */
+uint64_t hashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t k=0; k<size; k++) {
+        hash ^= bytes[k];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t hashString(const std::string& data, uint64_t hash = 14695981039346656037ULL)
+{
+    return hashBytes(data.data(), data.size(), hash);
+}
+
+bool programBinarySupported()
+{
+    if (!gladLoadGLExtension("GL_ARB_get_program_binary"))
+        return false;
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+std::string programCachePath(uint64_t key)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "%s/%016llx.bin", SHADER_CACHE_DIR, (unsigned long long)key);
+    return path;
+}
+
+/* Program from a cached binary, 0 if there is none or the driver rejects it */
+GLuint loadCachedProgram(uint64_t key)
+{
+    if (!programBinarySupported())
+        return 0;
+
+    std::string data = readFile(programCachePath(key).c_str());
+    if (data.size() <= 4 + sizeof(GLenum) || memcmp(data.data(), PROGRAM_CACHE_MAGIC, 4) != 0)
+        return 0;
+
+    GLenum format;
+    memcpy(&format, data.data() + 4, sizeof(format));
+    size_t header = 4 + sizeof(format);
+
+    GLuint ProgramID = glCreateProgram();
+    glProgramBinary(ProgramID, format, data.data() + header, data.size() - header);
+
+    GLint Result = GL_FALSE;
+    glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
+    if (Result != GL_TRUE) {
+        // stale binary, e.g. after a driver update
+        glDeleteProgram(ProgramID);
+        return 0;
+    }
+    return ProgramID;
+}
+
+void saveCachedProgram(uint64_t key, GLuint ProgramID)
+{
+    if (!programBinarySupported())
+        return;
+
+    GLint length = 0;
+    glGetProgramiv(ProgramID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(length);
+    GLenum format;
+    glGetProgramBinary(ProgramID, length, NULL, &format, &binary[0]);
+
+    mkdir(SHADER_CACHE_DIR, 0755);
+    FILE* fp = fopen(programCachePath(key).c_str(), "wb");
+    if (fp == NULL)
+        return;
+    fwrite(PROGRAM_CACHE_MAGIC, 1, 4, fp);
+    fwrite(&format, sizeof(format), 1, fp);
+    fwrite(&binary[0], 1, length, fp);
+    fclose(fp);
+}
 
-/* Function to load Shaders - Use it as it is */
+/* Function to load Shaders - linked programs are cached on disk */
 GLuint LoadShaders(const char * vertex_file_path,const char * fragment_file_path) {
 
-	// Create the shaders
-	GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-	GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+	// Read the shader sources
+	std::string VertexShaderCode = readFile(vertex_file_path);
+	std::string FragmentShaderCode = readFile(fragment_file_path);
 
-	// Read the Vertex Shader code from the file
-	std::string VertexShaderCode;
-	std::ifstream VertexShaderStream(vertex_file_path, std::ios::in);
-	if(VertexShaderStream.is_open())
-	{
-		std::string Line = "";
-		while(getline(VertexShaderStream, Line))
-			VertexShaderCode += "\n" + Line;
-		VertexShaderStream.close();
-	}
+	// Binaries only work with the driver that produced them, so it is part of the key
+	std::string driver = std::string((const char*)glGetString(GL_RENDERER)) + (const char*)glGetString(GL_VERSION);
+	uint64_t key = hashString(FragmentShaderCode, hashString(std::string(1, '\0'), hashString(VertexShaderCode)));
+	key = hashString(driver, key);
 
-	// Read the Fragment Shader code from the file
-	std::string FragmentShaderCode;
-	std::ifstream FragmentShaderStream(fragment_file_path, std::ios::in);
-	if(FragmentShaderStream.is_open()){
-		std::string Line = "";
-		while(getline(FragmentShaderStream, Line))
-			FragmentShaderCode += "\n" + Line;
-		FragmentShaderStream.close();
+	GLuint CachedProgramID = loadCachedProgram(key);
+	if (CachedProgramID) {
+		printf("Loaded cached program : %s %s\n", vertex_file_path, fragment_file_path);
+		return CachedProgramID;
 	}
 
+	// Create the shaders
+	GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
+	GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+
 	GLint Result = GL_FALSE;
 	int InfoLogLength;
 
@@ -102,6 +318,8 @@ GLuint LoadShaders(const char * vertex_file_path,const char * fragment_file_path
 	GLuint ProgramID = glCreateProgram();
 	glAttachShader(ProgramID, VertexShaderID);
 	glAttachShader(ProgramID, FragmentShaderID);
+	if (programBinarySupported())
+		glProgramParameteri(ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 	glLinkProgram(ProgramID);
 
 	// Check the program
@@ -114,19 +332,86 @@ GLuint LoadShaders(const char * vertex_file_path,const char * fragment_file_path
 	glDeleteShader(VertexShaderID);
 	glDeleteShader(FragmentShaderID);
 
+	if (Result == GL_TRUE)
+		saveCachedProgram(key, ProgramID);
+
 	return ProgramID;
 }
 
-static void error_callback(int error, const char* description)
+static void error_callback(int /*error*/, const char* description)
 {
     fprintf(stderr, "Error: %s\n", description);
 }
 
+/* Ends the main loop, which releases the level before closing the window */
 void quit(GLFWwindow *window)
 {
-    glfwDestroyWindow(window);
-    glfwTerminate();
-    exit(EXIT_SUCCESS);
+    glfwSetWindowShouldClose(window, GL_TRUE);
+}
+
+/* IEEE half float, round to nearest; denormals flush to zero */
+GLushort floatToHalf (float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (exponent <= 0)
+        return sign;
+    if (exponent >= 31)
+        return sign | 0x7c00;
+    // a carry out of the mantissa correctly bumps the exponent
+    return (sign | (exponent << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1);
+}
+
+/* Convert one float component to the attribute's storage type */
+void packComponent (const VertexAttrib& attrib, float value, unsigned char* dst)
+{
+    switch (attrib.Type) {
+        case GL_HALF_FLOAT: {
+            GLushort h = floatToHalf(value);
+            memcpy(dst, &h, sizeof(h));
+            break;
+        }
+        case GL_SHORT: {
+            GLshort v = (GLshort)lround(max(-1.0f, min(1.0f, value)) * 32767.0f);
+            memcpy(dst, &v, sizeof(v));
+            break;
+        }
+        case GL_UNSIGNED_BYTE:
+            *dst = (unsigned char)lround(max(0.0f, min(1.0f, value)) * 255.0f);
+            break;
+        default:
+            memcpy(dst, &value, sizeof(value));
+            break;
+    }
+}
+
+/* Interleave xyz positions and rgb colors into layout; alpha is always 1 */
+vector<unsigned char> packVertices (const VertexLayout* layout, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data)
+{
+    vector<unsigned char> data((size_t)layout->Stride*numVertices, 0);
+    for (int a=0; a<layout->NumAttribs; a++) {
+        const VertexAttrib& attrib = layout->Attribs[a];
+        const GLfloat* src = attrib.Index == 0 ? vertex_buffer_data : color_buffer_data;
+        int componentSize = attrib.Type == GL_FLOAT ? 4 : attrib.Type == GL_UNSIGNED_BYTE ? 1 : 2;
+
+        for (int v=0; v<numVertices; v++) {
+            unsigned char* dst = &data[(size_t)v*layout->Stride + attrib.Offset];
+            for (int c=0; c<attrib.Size; c++)
+                packComponent(attrib, c < 3 ? src[3*v + c] : 1.0f, dst + c*componentSize);
+        }
+    }
+    return data;
+}
+
+/* Point an attribute at the currently bound GL_ARRAY_BUFFER */
+void setVertexAttrib (const VertexAttrib& attrib, int stride)
+{
+    glVertexAttribPointer(attrib.Index, attrib.Size, attrib.Type, attrib.Normalized, stride, (void*)(size_t)attrib.Offset);
+    glEnableVertexAttribArray(attrib.Index);
 }
 
 glm::vec3 getRGBfromHue (int hue)
@@ -149,50 +434,195 @@ glm::vec3 getRGBfromHue (int hue)
     return glm::vec3(1,0,x);
 }
 
+/******************
+ * GL state cache *
+ ******************/
+
+// Shadows the GL binding state so that setting what is already set costs
+// nothing. Every bind of these goes through here, or the shadow goes stale.
+struct GLStateCache {
+    GLuint program;
+    GLuint vertex_array;
+    GLuint array_buffer;
+    GLenum polygon_mode;
+} gl_state = { 0, 0, 0, GL_FILL };
+
+// GL calls issued by the draw path and calls the cache skipped, reset every frame
+int gl_calls = 0, gl_calls_skipped = 0;
+
+void useProgram (GLuint program)
+{
+    if (gl_state.program == program) {
+        gl_calls_skipped++;
+        return;
+    }
+    glUseProgram(program);
+    gl_state.program = program;
+    gl_calls++;
+}
+
+void bindVertexArray (GLuint vertex_array)
+{
+    if (gl_state.vertex_array == vertex_array) {
+        gl_calls_skipped++;
+        return;
+    }
+    glBindVertexArray(vertex_array);
+    gl_state.vertex_array = vertex_array;
+    gl_calls++;
+}
+
+void bindArrayBuffer (GLuint buffer)
+{
+    if (gl_state.array_buffer == buffer) {
+        gl_calls_skipped++;
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    gl_state.array_buffer = buffer;
+    gl_calls++;
+}
+
+void setPolygonMode (GLenum mode)
+{
+    if (gl_state.polygon_mode == mode) {
+        gl_calls_skipped++;
+        return;
+    }
+    glPolygonMode(GL_FRONT_AND_BACK, mode);
+    gl_state.polygon_mode = mode;
+    gl_calls++;
+}
+
+/* Deleting a bound object unbinds it */
+void deleteVertexArray (GLuint vertex_array)
+{
+    glDeleteVertexArrays(1, &vertex_array);
+    if (gl_state.vertex_array == vertex_array)
+        gl_state.vertex_array = 0;
+}
+
+void deleteArrayBuffer (GLuint buffer)
+{
+    glDeleteBuffers(1, &buffer);
+    if (gl_state.array_buffer == buffer)
+        gl_state.array_buffer = 0;
+}
+
+/*********
+ * Arena *
+ *********/
+
+// Everything built for the current level lives in level_arena: VAO structs and
+// staging arrays are carved out of large blocks, and GL objects are listed as
+// they are generated. freeArena() releases all of it at once, so reloading a
+// level never leaves anything behind.
+const size_t ARENA_BLOCK_SIZE = 64*1024;
+
+struct Arena {
+    vector<char*> blocks;
+    size_t used;                // bytes taken from the last block
+    vector<GLuint> vertex_arrays, buffers;
+} level_arena;
+
+void* arenaAlloc (Arena& arena, size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+    if (arena.blocks.empty() || arena.used + size > ARENA_BLOCK_SIZE) {
+        char* block = (char*)malloc(max(size, ARENA_BLOCK_SIZE));
+        if (block == NULL) {
+            fprintf(stderr, "Error: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        arena.blocks.push_back(block);
+        arena.used = 0;
+    }
+    void* memory = arena.blocks.back() + arena.used;
+    arena.used += size;
+    return memory;
+}
+
+/* glGenVertexArrays/glGenBuffers for one object, recorded in the arena if there is one */
+GLuint genVertexArray (Arena* arena)
+{
+    GLuint vertex_array;
+    glGenVertexArrays(1, &vertex_array);
+    if (arena != NULL)
+        arena->vertex_arrays.push_back(vertex_array);
+    return vertex_array;
+}
+
+GLuint genBuffer (Arena* arena)
+{
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    if (arena != NULL)
+        arena->buffers.push_back(buffer);
+    return buffer;
+}
+
+void freeArena (Arena& arena)
+{
+    if (!arena.vertex_arrays.empty())
+        glDeleteVertexArrays(arena.vertex_arrays.size(), &arena.vertex_arrays[0]);
+    if (!arena.buffers.empty())
+        glDeleteBuffers(arena.buffers.size(), &arena.buffers[0]);
+    // deleted objects that were bound are unbound
+    gl_state.vertex_array = 0;
+    gl_state.array_buffer = 0;
+    arena.vertex_arrays.clear();
+    arena.buffers.clear();
+
+    for (size_t b=0; b<arena.blocks.size(); b++)
+        free(arena.blocks[b]);
+    arena.blocks.clear();
+    arena.used = 0;
+}
+
 /* Generate VAO, VBOs and return VAO handle */
-struct VAO* create3DObject (GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data, GLenum fill_mode=GL_FILL)
+/* Positions and colors are interleaved into one VBO in the given layout. With
+   no arena the caller owns the VAO and its buffers, and frees them with free3DObject */
+struct VAO* create3DObject (Arena* arena, const VertexLayout* layout, GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data, GLenum fill_mode)
 {
-    struct VAO* vao = new struct VAO;
+    struct VAO* vao = arena ? new (arenaAlloc(*arena, sizeof(VAO))) VAO : new VAO;
+    vao->Owner = arena;
     vao->PrimitiveMode = primitive_mode;
     vao->NumVertices = numVertices;
     vao->FillMode = fill_mode;
+    vao->Layout = layout;
+    vao->ColorBuffer = 0;
+    vao->IndexBuffer = 0;
+    vao->InstanceBuffer = 0;
+    vao->IndexType = GL_UNSIGNED_SHORT;
+    vao->NumIndices = 0;
+    vao->NumInstances = 0;
+
+    vector<unsigned char> interleaved_data = packVertices(layout, numVertices, vertex_buffer_data, color_buffer_data);
 
     // Create Vertex Array Object
     // Should be done after CreateWindow and before any other GL calls
-    glGenVertexArrays(1, &(vao->VertexArrayID)); // VAO
-    glGenBuffers (1, &(vao->VertexBuffer)); // VBO - vertices
-    glGenBuffers (1, &(vao->ColorBuffer));  // VBO - colors
-
-    glBindVertexArray (vao->VertexArrayID); // Bind the VAO 
-    glBindBuffer (GL_ARRAY_BUFFER, vao->VertexBuffer); // Bind the VBO vertices 
-    glBufferData (GL_ARRAY_BUFFER, 3*numVertices*sizeof(GLfloat), vertex_buffer_data, GL_STATIC_DRAW); // Copy the vertices into VBO
-    glVertexAttribPointer(
-                          0,                  // attribute 0. Vertices
-                          3,                  // size (x,y,z)
-                          GL_FLOAT,           // type
-                          GL_FALSE,           // normalized?
-                          0,                  // stride
-                          (void*)0            // array buffer offset
-                          );
-
-    glBindBuffer (GL_ARRAY_BUFFER, vao->ColorBuffer); // Bind the VBO colors 
-    glBufferData (GL_ARRAY_BUFFER, 3*numVertices*sizeof(GLfloat), color_buffer_data, GL_STATIC_DRAW);  // Copy the vertex colors
-    glVertexAttribPointer(
-                          1,                  // attribute 1. Color
-                          3,                  // size (r,g,b)
-                          GL_FLOAT,           // type
-                          GL_FALSE,           // normalized?
-                          0,                  // stride
-                          (void*)0            // array buffer offset
-                          );
+    vao->VertexArrayID = genVertexArray(vao->Owner); // VAO
+    vao->VertexBuffer = genBuffer(vao->Owner); // VBO - vertices and colors
+
+    bindVertexArray (vao->VertexArrayID); // Bind the VAO 
+    bindArrayBuffer (vao->VertexBuffer); // Bind the VBO vertices 
+    glBufferData (GL_ARRAY_BUFFER, interleaved_data.size(), &interleaved_data[0], GL_STATIC_DRAW); // Copy the vertices into VBO
+    for (int a=0; a<layout->NumAttribs; a++)
+        setVertexAttrib(layout->Attribs[a], layout->Stride);
 
     return vao;
 }
 
+/* Level object in the current vertex_format */
+struct VAO* create3DObject (GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data, GLenum fill_mode=GL_FILL)
+{
+    return create3DObject(&level_arena, &vertexLayouts[vertex_format], primitive_mode, numVertices, vertex_buffer_data, color_buffer_data, fill_mode);
+}
+
 /* Generate VAO, VBOs and return VAO handle - Common Color for all vertices */
 struct VAO* create3DObject (GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat red, const GLfloat green, const GLfloat blue, GLenum fill_mode=GL_FILL)
 {
-    GLfloat* color_buffer_data = new GLfloat [3*numVertices];
+    GLfloat* color_buffer_data = (GLfloat*)arenaAlloc(level_arena, 3*numVertices*sizeof(GLfloat));
     for (int i=0; i<numVertices; i++) {
         color_buffer_data [3*i] = red;
         color_buffer_data [3*i + 1] = green;
@@ -202,27 +632,570 @@ struct VAO* create3DObject (GLenum primitive_mode, int numVertices, const GLfloa
     return create3DObject(primitive_mode, numVertices, vertex_buffer_data, color_buffer_data, fill_mode);
 }
 
+/* Generate VAO, VBOs and an element buffer - vertices shared between triangles are stored once */
+struct VAO* createIndexed3DObject (Arena* arena, const VertexLayout* layout, GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data, int numIndices, const GLushort* index_buffer_data, GLenum fill_mode)
+{
+    struct VAO* vao = create3DObject(arena, layout, primitive_mode, numVertices, vertex_buffer_data, color_buffer_data, fill_mode);
+    vao->NumIndices = numIndices;
+
+    vao->IndexBuffer = genBuffer(vao->Owner); // EBO - indices
+
+    // The element buffer binding is part of the VAO state
+    bindVertexArray (vao->VertexArrayID);
+    glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, vao->IndexBuffer);
+    glBufferData (GL_ELEMENT_ARRAY_BUFFER, numIndices*sizeof(GLushort), index_buffer_data, GL_STATIC_DRAW);
+
+    return vao;
+}
+
+struct VAO* createIndexed3DObject (GLenum primitive_mode, int numVertices, const GLfloat* vertex_buffer_data, const GLfloat* color_buffer_data, int numIndices, const GLushort* index_buffer_data, GLenum fill_mode=GL_FILL)
+{
+    return createIndexed3DObject(&level_arena, &vertexLayouts[vertex_format], primitive_mode, numVertices, vertex_buffer_data, color_buffer_data, numIndices, index_buffer_data, fill_mode);
+}
+
+/* Generate a VAO drawing the vertices and indices of an existing one with its own colors */
+struct VAO* recolor3DObject (struct VAO* mesh, const GLfloat* color_buffer_data)
+{
+    struct VAO* vao = new (arenaAlloc(level_arena, sizeof(VAO))) VAO(*mesh);
+    vao->Owner = &level_arena;
+    vao->InstanceBuffer = 0;
+    vao->NumInstances = 0;
+
+    vao->VertexArrayID = genVertexArray(vao->Owner);
+    vao->ColorBuffer = genBuffer(vao->Owner);
+
+    // positions come from the mesh's interleaved VBO, colors from a VBO of their own
+    vector<unsigned char> packed_colors = packVertices(&colorOnlyLayout, vao->NumVertices, NULL, color_buffer_data);
+
+    bindVertexArray (vao->VertexArrayID);
+    bindArrayBuffer (vao->VertexBuffer); // shared with mesh
+    setVertexAttrib(mesh->Layout->Attribs[0], mesh->Layout->Stride);
+
+    bindArrayBuffer (vao->ColorBuffer);
+    glBufferData (GL_ARRAY_BUFFER, packed_colors.size(), &packed_colors[0], GL_STATIC_DRAW);
+    setVertexAttrib(colorOnlyLayout.Attribs[0], colorOnlyLayout.Stride);
+
+    if (vao->IndexBuffer)
+        glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, vao->IndexBuffer); // shared with mesh
+
+    return vao;
+}
+
+/* Generate a VAO drawing the buffers of an existing one, ready for instance offsets of its own */
+/* The caller owns the new VAO and its instance buffer, and deletes them with delete3DObject */
+struct VAO* share3DObject (struct VAO* mesh)
+{
+    struct VAO* vao = new struct VAO(*mesh);
+    vao->Owner = NULL;
+    vao->InstanceBuffer = 0;
+    vao->NumInstances = 0;
+
+    vao->VertexArrayID = genVertexArray(vao->Owner);
+
+    bindVertexArray (vao->VertexArrayID);
+    bindArrayBuffer (vao->VertexBuffer); // shared with mesh
+    if (vao->ColorBuffer) {
+        setVertexAttrib(mesh->Layout->Attribs[0], mesh->Layout->Stride);
+        bindArrayBuffer (vao->ColorBuffer); // shared with mesh
+        setVertexAttrib(colorOnlyLayout.Attribs[0], colorOnlyLayout.Stride);
+    }
+    else {
+        for (int a=0; a<mesh->Layout->NumAttribs; a++)
+            setVertexAttrib(mesh->Layout->Attribs[a], mesh->Layout->Stride);
+    }
+
+    if (vao->IndexBuffer)
+        glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, vao->IndexBuffer); // shared with mesh
+
+    return vao;
+}
+
+/* Release a VAO from share3DObject, leaving the buffers it shares alone */
+void delete3DObject (struct VAO* vao)
+{
+    if (vao->InstanceBuffer)
+        deleteArrayBuffer(vao->InstanceBuffer);
+    deleteVertexArray(vao->VertexArrayID);
+    delete vao;
+}
+
+/* Release a VAO from create3DObject with no arena, with the buffers it owns */
+void free3DObject (struct VAO* vao)
+{
+    deleteArrayBuffer(vao->VertexBuffer);
+    if (vao->ColorBuffer)
+        deleteArrayBuffer(vao->ColorBuffer);
+    if (vao->IndexBuffer)
+        glDeleteBuffers(1, &vao->IndexBuffer);
+    delete3DObject(vao);
+}
+
+// triangles submitted by the draw path, reset every frame
+int triangles_drawn = 0;
+
+void countTriangles (const struct VAO* vao, int instances)
+{
+    if (vao->PrimitiveMode == GL_TRIANGLES)
+        triangles_drawn += (vao->IndexBuffer ? vao->NumIndices : vao->NumVertices) / 3 * instances;
+}
+
 /* Render the VBOs handled by VAO */
 void draw3DObject (struct VAO* vao)
 {
     // Change the Fill Mode for this object
-    glPolygonMode (GL_FRONT_AND_BACK, vao->FillMode);
+    setPolygonMode (vao->FillMode);
+
+    // Bind the VAO to use; it holds the attribute setup and the buffers, so
+    // nothing else needs binding
+    bindVertexArray (vao->VertexArrayID);
+
+    // Draw the geometry !
+    gl_calls++;
+    countTriangles(vao, 1);
+    if (vao->IndexBuffer)
+        glDrawElements(vao->PrimitiveMode, vao->NumIndices, vao->IndexType, (void*)0);
+    else
+        glDrawArrays(vao->PrimitiveMode, 0, vao->NumVertices); // Starting from vertex 0; 3 vertices total -> 1 triangle
+}
 
-    // Bind the VAO to use
-    glBindVertexArray (vao->VertexArrayID);
+/* Attach a per-instance offset VBO (attribute 2) to an existing VAO */
+void setInstanceOffsets (struct VAO* vao, int numInstances, const GLfloat* offset_buffer_data)
+{
+    vao->NumInstances = numInstances;
+
+    // the VAO keeps the attribute pointing at the buffer, later calls only replace the data
+    if (vao->InstanceBuffer == 0) {
+        vao->InstanceBuffer = genBuffer(vao->Owner); // VBO - instance offsets
+        bindVertexArray (vao->VertexArrayID);
+        bindArrayBuffer (vao->InstanceBuffer);
+        setVertexAttrib(instanceOffsetAttrib, 0);
+        glVertexAttribDivisor(instanceOffsetAttrib.Index, 1); // advance once per instance, not per vertex
+    }
 
-    // Enable Vertex Attribute 0 - 3d Vertices
-    glEnableVertexAttribArray(0);
-    // Bind the VBO to use
-    glBindBuffer(GL_ARRAY_BUFFER, vao->VertexBuffer);
+    bindArrayBuffer (vao->InstanceBuffer);
+    glBufferData (GL_ARRAY_BUFFER, 3*numInstances*sizeof(GLfloat), offset_buffer_data, GL_DYNAMIC_DRAW);
+    gl_calls++;
+}
 
-    // Enable Vertex Attribute 1 - Color
-    glEnableVertexAttribArray(1);
-    // Bind the VBO to use
-    glBindBuffer(GL_ARRAY_BUFFER, vao->ColorBuffer);
+/* Overwrite the offset of a single instance */
+void updateInstanceOffset (struct VAO* vao, int instance, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLfloat offset[3] = { x, y, z };
+    bindArrayBuffer (vao->InstanceBuffer);
+    glBufferSubData (GL_ARRAY_BUFFER, 3*instance*sizeof(GLfloat), sizeof(offset), offset);
+    gl_calls++;
+}
 
-    // Draw the geometry !
-    glDrawArrays(vao->PrimitiveMode, 0, vao->NumVertices); // Starting from vertex 0; 3 vertices total -> 1 triangle
+/* Render all instances of the VAO with a single draw call */
+void draw3DObjectInstanced (struct VAO* vao)
+{
+    setPolygonMode (vao->FillMode);
+    bindVertexArray (vao->VertexArrayID);
+
+    gl_calls++;
+    countTriangles(vao, vao->NumInstances);
+    if (vao->IndexBuffer)
+        glDrawElementsInstanced(vao->PrimitiveMode, vao->NumIndices, vao->IndexType, (void*)0, vao->NumInstances);
+    else
+        glDrawArraysInstanced(vao->PrimitiveMode, 0, vao->NumVertices, vao->NumInstances);
+}
+
+/*************
+ * Profiling *
+ *************/
+
+/* Print min/median/p99 of a list of frame phase durations (seconds) in ms */
+void reportTimes(const char* name, vector<double>& times)
+{
+    if (times.empty())
+        return;
+    sort(times.begin(), times.end());
+    size_t p99 = min(times.size()-1, (size_t)(0.99*times.size()));
+    printf("%-10s min %8.3f ms  median %8.3f ms  p99 %8.3f ms\n", name,
+           1000*times[0], 1000*times[times.size()/2], 1000*times[p99]);
+}
+
+/* Seconds from an arbitrary start, usable without GLFW */
+double monotonicTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+struct TraceEvent {
+    const char* name;
+    int track;              // TRACK_CPU, TRACK_GPU or TRACK_SIM
+    double start, duration; // seconds
+};
+enum { TRACK_CPU = 0, TRACK_GPU = 1, TRACK_SIM = 2 };
+
+// the simulation thread records too
+pthread_mutex_t profiling_lock = PTHREAD_MUTEX_INITIALIZER;
+
+vector<TraceEvent> trace_events;
+map<string, vector<double> > timing_samples;    // durations per timer name
+
+void recordTiming(const char* name, int track, double start, double duration)
+{
+    if (!profiling)
+        return;
+    pthread_mutex_lock(&profiling_lock);
+    timing_samples[name].push_back(duration);
+    if (trace_path != NULL) {
+        TraceEvent event = { name, track, start, duration };
+        trace_events.push_back(event);
+    }
+    pthread_mutex_unlock(&profiling_lock);
+}
+
+/* Times the enclosing scope */
+struct ScopedTimer {
+    const char* name;
+    int track;
+    double start;
+
+    ScopedTimer(const char* timer_name, int timer_track=TRACK_CPU) : name(timer_name), track(timer_track), start(monotonicTime()) {}
+    ~ScopedTimer() { recordTiming(name, track, start, monotonicTime() - start); }
+};
+
+// GPU time of draw() from GL_TIME_ELAPSED queries. Results are read a few
+// frames later so waiting for them never stalls the pipeline.
+const int GPU_QUERY_FRAMES = 4;
+GLuint gpu_queries[GPU_QUERY_FRAMES];
+double gpu_query_start[GPU_QUERY_FRAMES];
+bool gpu_query_pending[GPU_QUERY_FRAMES];
+int gpu_query_frame = 0;
+
+void initGpuTimers()
+{
+    if (!profiling)
+        return;
+    glGenQueries(GPU_QUERY_FRAMES, gpu_queries);
+}
+
+void beginGpuTimer()
+{
+    if (!profiling)
+        return;
+    int q = gpu_query_frame % GPU_QUERY_FRAMES;
+    if (gpu_query_pending[q]) {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(gpu_queries[q], GL_QUERY_RESULT, &elapsed);
+        // GPU work is placed on the trace where its CPU submission started
+        recordTiming("gpu draw", TRACK_GPU, gpu_query_start[q], elapsed*1e-9);
+    }
+    gpu_query_start[q] = monotonicTime();
+    glBeginQuery(GL_TIME_ELAPSED, gpu_queries[q]);
+}
+
+void endGpuTimer()
+{
+    if (!profiling)
+        return;
+    glEndQuery(GL_TIME_ELAPSED);
+    gpu_query_pending[gpu_query_frame % GPU_QUERY_FRAMES] = true;
+    gpu_query_frame++;
+}
+
+/* Chrome trace event format, viewable in chrome://tracing or Perfetto */
+bool writeTrace(const char* path)
+{
+    FILE* fp = fopen(path, "w");
+    if (fp == NULL)
+        return false;
+
+    fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"CPU\"}},\n", TRACK_CPU);
+    fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"GPU\"}},\n", TRACK_GPU);
+    fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Simulation\"}}", TRACK_SIM);
+    double origin = trace_events.empty() ? 0 : trace_events[0].start;
+    for (size_t k=0; k<trace_events.size(); k++)
+        origin = min(origin, trace_events[k].start);
+    for (size_t k=0; k<trace_events.size(); k++) {
+        const TraceEvent& event = trace_events[k];
+        fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                event.name, event.track, 1e6*(event.start - origin), 1e6*event.duration);
+    }
+    fprintf(fp, "\n]}\n");
+    return fclose(fp) == 0;
+}
+
+// how long each startup phase took, in the order they ran
+vector<pair<const char*, double> > startup_times;
+
+/* Ends the startup phase that began at start */
+void timeStartup(const char* name, double start)
+{
+    double duration = monotonicTime() - start;
+    startup_times.push_back(make_pair(name, duration));
+    if (profiling && trace_path != NULL) {
+        TraceEvent event = { name, TRACK_CPU, start, duration };
+        trace_events.push_back(event);
+    }
+}
+
+/* Printed once, before the first frame */
+void reportStartup()
+{
+    if (!profiling)
+        return;
+    double total = 0;
+    printf("startup");
+    for (size_t k=0; k<startup_times.size(); k++) {
+        printf("%s %s %.3f ms", k ? "," : ":", startup_times[k].first, 1000*startup_times[k].second);
+        total += startup_times[k].second;
+    }
+    printf(", total %.3f ms\n", 1000*total);
+}
+
+/* Registered with atexit so every way of quitting reports */
+void finishProfiling()
+{
+    if (!profiling)
+        return;
+    for (map<string, vector<double> >::iterator it = timing_samples.begin(); it != timing_samples.end(); ++it)
+        reportTimes(it->first.c_str(), it->second);
+    if (trace_path != NULL) {
+        if (writeTrace(trace_path))
+            printf("wrote %d trace events to %s\n", (int)trace_events.size(), trace_path);
+        else
+            fprintf(stderr, "Error: can't write trace %s\n", trace_path);
+    }
+}
+
+/* Create the uniform buffer behind the Camera block */
+void initCamera ()
+{
+    glGenBuffers (1, &cameraUBO);
+    glBindBuffer (GL_UNIFORM_BUFFER, cameraUBO);
+    glBufferData (GL_UNIFORM_BUFFER, sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase (GL_UNIFORM_BUFFER, CAMERA_BINDING, cameraUBO);
+}
+
+/* Point a program's Camera block at the shared buffer */
+void bindCameraBlock (GLuint program)
+{
+    GLuint index = glGetUniformBlockIndex(program, "Camera");
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, index, CAMERA_BINDING);
+}
+
+/* Upload VP if it differs from what the buffer already holds */
+void updateCamera (const glm::mat4& VP)
+{
+    if (cameraValid && memcmp(&VP[0][0], &cameraVP[0][0], sizeof(glm::mat4)) == 0)
+        return;
+    cameraVP = VP;
+    cameraValid = true;
+
+    glBindBuffer (GL_UNIFORM_BUFFER, cameraUBO);
+    glBufferSubData (GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), &VP[0][0]);
+    gl_calls += 2;
+}
+
+/*********
+ * Input *
+ *********/
+
+// Player input goes through a ring buffer instead of touching entities from
+// the GLFW callback: keyboard() appends, the simulation applies whatever is
+// queued at the start of its next step, and the render loop measures how long
+// each event took to reach the screen once a frame drawn from that step has
+// been swapped. Each index has a single writer, so no lock is needed even
+// with --sim-thread.
+enum PlayerAction { ACTION_UP, ACTION_DOWN, ACTION_LEFT, ACTION_RIGHT, ACTION_RESET, ACTION_JUMP };
+
+struct InputEvent {
+    int action;
+    double time;            // monotonicTime() when the event was polled
+    long step;              // simulation step that applied it
+};
+const unsigned INPUT_QUEUE_SIZE = 256;  // power of two
+InputEvent input_queue[INPUT_QUEUE_SIZE];
+unsigned input_written = 0;     // by keyboard()
+unsigned input_applied = 0;     // by the simulation
+unsigned input_measured = 0;    // by the render loop
+int input_dropped = 0;
+vector<double> input_latencies; // seconds from poll to the swap showing the effect
+
+long sim_step = 0;              // steps simulated so far
+
+// --record FILE: every applied action with its step, written on exit
+struct InputRecord {
+    int32_t step;
+    int32_t action;
+};
+const char* record_path = NULL;
+vector<InputRecord> recorded_inputs;
+
+void queueInput(int action)
+{
+    // slots are reused only once their latency has been measured
+    if (input_written - input_measured == INPUT_QUEUE_SIZE) {
+        input_dropped++;
+        return;
+    }
+    InputEvent& event = input_queue[input_written % INPUT_QUEUE_SIZE];
+    event.action = action;
+    event.time = monotonicTime();
+    __atomic_store_n(&input_written, input_written + 1, __ATOMIC_RELEASE);
+}
+
+void applyPlayerAction(int action)
+{
+    switch (action) {
+        case ACTION_UP:
+            entities.y[PLAYER] += 0.5;
+            break;
+        case ACTION_DOWN:
+            entities.y[PLAYER] -= 0.5;
+            break;
+        case ACTION_LEFT:
+            entities.x[PLAYER] -= 0.5;
+            break;
+        case ACTION_RIGHT:
+            entities.x[PLAYER] += 0.5;
+            break;
+        case ACTION_RESET:
+            entities.x[PLAYER] = -2;
+            entities.y[PLAYER] = -2;
+            entities.z[PLAYER] = 0;
+            entities.jump[PLAYER] = 0;
+            break;
+        case ACTION_JUMP:
+            if (entities.jump[PLAYER] == 0) {
+                entities.jump[PLAYER] = 4;
+                entities.jump_base[PLAYER] = entities.z[PLAYER];
+            }
+            break;
+    }
+}
+
+/* Called by the simulation at the start of step sim_step */
+void applyInput()
+{
+    unsigned written = __atomic_load_n(&input_written, __ATOMIC_ACQUIRE);
+    unsigned applied = input_applied;
+    for (; applied != written; applied++) {
+        InputEvent& event = input_queue[applied % INPUT_QUEUE_SIZE];
+        applyPlayerAction(event.action);
+        event.step = sim_step;
+        if (record_path != NULL) {
+            InputRecord record = { (int32_t)sim_step, event.action };
+            recorded_inputs.push_back(record);
+        }
+    }
+    __atomic_store_n(&input_applied, applied, __ATOMIC_RELEASE);
+}
+
+/* Called after a frame drawn from step drawn_step was swapped at time now */
+void measureInputLatency(long drawn_step, double now)
+{
+    unsigned applied = __atomic_load_n(&input_applied, __ATOMIC_ACQUIRE);
+    for (; input_measured != applied; input_measured++) {
+        const InputEvent& event = input_queue[input_measured % INPUT_QUEUE_SIZE];
+        if (event.step > drawn_step)
+            break;
+        input_latencies.push_back(now - event.time);
+    }
+}
+
+/* Registered with atexit */
+void reportInputLatency()
+{
+    if (input_latencies.empty())
+        return;
+    printf("%d input events, %d dropped\n", (int)input_latencies.size(), input_dropped);
+    reportTimes("input", input_latencies);
+}
+
+/****************
+ * Frame pacing *
+ ****************/
+
+const char* presentModeNames[] = { "default", "vsync", "adaptive", "uncapped" };
+
+bool parsePresentMode(const char* name)
+{
+    for (int m=PRESENT_VSYNC; m<=PRESENT_UNCAPPED; m++)
+        if (strcmp(name, presentModeNames[m]) == 0) {
+            present_mode = (PresentMode)m;
+            return true;
+        }
+    return false;
+}
+
+/* Set the swap interval for present_mode; needs a current context */
+void applyPresentMode()
+{
+    // benchmarks and frame-limited runs don't wait for vblank unless asked to
+    if (present_mode == PRESENT_DEFAULT)
+        present_mode = bench_frames > 0 || fps_limit > 0 ? PRESENT_UNCAPPED : PRESENT_VSYNC;
+
+    if (present_mode == PRESENT_ADAPTIVE &&
+        !glfwExtensionSupported("GLX_EXT_swap_control_tear") && !glfwExtensionSupported("WGL_EXT_swap_control_tear")) {
+        fprintf(stderr, "Adaptive vsync is not supported, using vsync\n");
+        present_mode = PRESENT_VSYNC;
+    }
+
+    switch (present_mode) {
+        case PRESENT_ADAPTIVE:
+            glfwSwapInterval(-1); // late frames are swapped right away instead of waiting a whole refresh
+            break;
+        case PRESENT_UNCAPPED:
+            glfwSwapInterval(0);
+            break;
+        default:
+            glfwSwapInterval(1);
+            break;
+    }
+}
+
+// The limiter sleeps until FRAME_SPIN_TIME before the deadline and spins the
+// rest, since a sleep can overshoot by a scheduler tick
+const double FRAME_SPIN_TIME = 0.002;
+double frame_deadline = 0;
+long frames_presented = 0;
+double first_present_time = 0, last_present_time = 0;
+
+/* Called after every swap: waits out the rest of the frame under --fps-limit */
+void paceFrame()
+{
+    if (fps_limit > 0) {
+        double frame_time = 1.0 / fps_limit;
+        double now = monotonicTime();
+        frame_deadline += frame_time;
+        // more than a frame late: start over from now instead of rushing to catch up
+        if (frame_deadline < now - frame_time)
+            frame_deadline = now;
+
+        double wake_time = frame_deadline - FRAME_SPIN_TIME;
+        if (wake_time > now) {
+            struct timespec wake;
+            wake.tv_sec = (time_t)wake_time;
+            wake.tv_nsec = (long)((wake_time - wake.tv_sec)*1e9);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+        }
+        while (monotonicTime() < frame_deadline)
+            ;
+    }
+
+    last_present_time = monotonicTime();
+    if (frames_presented++ == 0)
+        first_present_time = last_present_time;
+}
+
+/* Registered with atexit */
+void reportFrameRate()
+{
+    if (frames_presented < 2)
+        return;
+    double elapsed = last_present_time - first_present_time;
+    printf("%ld frames in %.2f s, %.1f fps (%s", frames_presented, elapsed, (frames_presented - 1) / elapsed, presentModeNames[present_mode]);
+    if (fps_limit > 0)
+        printf(", limited to %.1f fps", fps_limit);
+    printf(")\n");
 }
 
 /**************************
@@ -236,32 +1209,32 @@ bool rectangle_rot_status = true;
 
 
 
+// set by 'R': the main loop rebuilds the level's models before the next frame
+bool rebuild_level = false;
+
 /* Executed when a regular key is pressed/released/held-down */
 /* Prefered for Keyboard events */
-void keyboard (GLFWwindow* window, int key, int scancode, int action, int mods)
+void keyboard (GLFWwindow* window, int key, int /*scancode*/, int action, int /*mods*/)
 {
      // Function is called first on GLFW_PRESS.
 
     if (action == GLFW_RELEASE) {
         switch (key) {
             case GLFW_KEY_UP:
-                player_y_coordinate += 0.5;
+                queueInput(ACTION_UP);
                 break;
             case GLFW_KEY_DOWN:
-                player_y_coordinate -= 0.5;
+                queueInput(ACTION_DOWN);
                 break;
             case GLFW_KEY_LEFT:
-            	player_x_coordinate -= 0.5;	
-                // do something ..
+                queueInput(ACTION_LEFT);
                 break;
             case GLFW_KEY_RIGHT:
-            	player_x_coordinate += 0.5;	
-                // do something ..
+                queueInput(ACTION_RIGHT);
                 break;
             case GLFW_KEY_R:
-                player_x_coordinate = -2;
-                player_y_coordinate = -2;
-                player_z_coordinate = 0;
+                queueInput(ACTION_RESET);
+                rebuild_level = true;
                 break;
             case GLFW_KEY_1:  // 
             	eye_y = 0;
@@ -274,13 +1247,12 @@ void keyboard (GLFWwindow* window, int key, int scancode, int action, int mods)
                 eye_z = 2;
                 break;
             case GLFW_KEY_3:
-                eye_x = player_x_coordinate;
-                eye_y = player_y_coordinate;
+                eye_x = render_state.x[PLAYER];
+                eye_y = render_state.y[PLAYER];
                 eye_z = 2;
                 break;
             case GLFW_KEY_SPACE:
-                if (playerJump == 0)
-                    playerJump = 4;
+                queueInput(ACTION_JUMP);
                 break;
 
             default:
@@ -312,7 +1284,7 @@ void keyboardChar (GLFWwindow* window, unsigned int key)
 }
 
 /* Executed when a mouse button is pressed/released */
-void mouseButton (GLFWwindow* window, int button, int action, int mods)
+void mouseButton (GLFWwindow* /*window*/, int button, int action, int /*mods*/)
 {
     switch (button) {
         case GLFW_MOUSE_BUTTON_LEFT:
@@ -356,7 +1328,10 @@ void reshapeWindow (GLFWwindow* window, int width, int height)
    // Matrices.projection = glm::ortho(-4.0f, 4.0f, -4.0f, 4.0f, 0.1f, 500.0f);
 }
 
-VAO *triangle, *rectangle, *cube[11][11], *player;
+VAO *triangle, *rectangle, *tile, *grid, *staticFloor, *player, *agents;
+
+// Meshes are built once and shared by every object drawing them, keyed by name
+map<string, VAO*> meshCache;
 
 // Creates the triangle object used in this sample code
 void createTriangle ()
@@ -408,320 +1383,772 @@ void createRectangle ()
   rectangle = create3DObject(GL_TRIANGLES, 6, vertex_buffer_data, color_buffer_data, GL_FILL);
 }
 
-void createCube(double x_length,double y_length,double z_length,int x,int y)
-{
-
-	GLfloat vertex_buffer_data[] = {
-
-     -x_length,-x_length,-x_length, // triangle 1 : begin
-
-     -x_length,-x_length, x_length,
-
-     -x_length, x_length, x_length, // triangle 1 : end
-
-     x_length, x_length,-x_length, // triangle 2 : begin
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length,-x_length, // triangle 2 : end
-
-     x_length,-x_length, x_length,
-
-     -x_length,-x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length, x_length,
-
-     -x_length, x_length,-x_length,
-
-     x_length,-x_length, x_length,
-
-     -x_length,-x_length, x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length, x_length,
-
-     -x_length,-x_length, x_length,
-
-     x_length,-x_length, x_length,
-
-     x_length, x_length, x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length, x_length,
-
-     x_length,-x_length, x_length,
-
-     x_length, x_length, x_length,
-
-     x_length, x_length,-x_length,
-
-     -x_length, x_length,-x_length,
-
-     x_length, x_length, x_length,
-
-     -x_length, x_length,-x_length,
-
-     -x_length, x_length, x_length,
-
-     x_length, x_length, x_length,
-
-     -x_length, x_length, x_length,
-
-     x_length,-x_length, x_length,
-
- };
-
- GLfloat color_buffer_data[] = {
-
-     0.583f,  0.771f,  0.014f,
-
-     0.009f,  0.115f,  0.436f,
-
-     0.327f,  0.483f,  0.844f,
-
-     0.822f,  0.569f,  0.201f,
-
-     0.435f,  0.002f,  0.223f,
-
-     0.310f,  0.747f,  0.185f,
-
-     0.597f,  0.770f,  0.761f,
-
-     0.559f,  0.436f,  0.730f,
-
-     0.359f,  0.583f,  0.152f,
-
-     0.483f,  0.596f,  0.789f,
-
-     0.559f,  0.861f,  0.039f,
-
-     0.195f,  0.548f,  0.859f,
-
-     0.014f,  0.184f,  0.576f,
-
-     0.771f,  0.328f,  0.970f,
-
-     0.406f,  0.015f,  0.116f,
-
-     0.076f,  0.977f,  0.133f,
-
-     0.971f,  0.572f,  0.833f,
-
-     0.140f,  0.016f,  0.489f,
-
-     0.997f,  0.513f,  0.064f,
-
-     0.945f,  0.719f,  0.592f,
-
-     0.543f,  0.021f,  0.978f,
-
-     0.279f,  0.317f,  0.505f,
-
-     0.167f,  0.020f,  0.077f,
-
-     0.347f,  0.857f,  0.137f,
-
-     0.055f,  0.953f,  0.042f,
-
-     0.714f,  0.505f,  0.345f,
-
-     0.783f,  0.290f,  0.734f,
-
-     0.722f,  0.045f,  0.174f,
-
-     0.302f,  0.455f,  0.848f,
-
-     0.225f,  0.587f,  0.040f,
-
-     0.517f,  0.713f,  0.338f,
-
-     0.053f,  0.959f,  0.120f,
-
-     0.393f,  0.021f,  0.362f,
-
-     0.073f,  0.211f,  0.457f,
+// Unit cube faces in createCube's vertex order, 4 corners each, and their colors
+enum CubeFace { FACE_NEG_X, FACE_POS_X, FACE_NEG_Y, FACE_POS_Y, FACE_NEG_Z, FACE_POS_Z };
+const GLfloat cubeCorners[] = {
+    -1,-1,-1,  -1,-1, 1,  -1, 1, 1,  -1, 1,-1, // -x face
+     1,-1,-1,   1, 1,-1,   1, 1, 1,   1,-1, 1, // +x face
+    -1,-1,-1,   1,-1,-1,   1,-1, 1,  -1,-1, 1, // -y face
+    -1, 1,-1,  -1, 1, 1,   1, 1, 1,   1, 1,-1, // +y face
+    -1,-1,-1,  -1, 1,-1,   1, 1,-1,   1,-1,-1, // -z face
+    -1,-1, 1,   1,-1, 1,   1, 1, 1,  -1, 1, 1, // +z face
+};
+// two triangles per face
+const GLushort faceIndices[6] = { 0, 1, 2, 0, 2, 3 };
+const GLfloat cubeColors[] = {
+    0.583f, 0.771f, 0.014f,  0.009f, 0.115f, 0.436f,  0.327f, 0.483f, 0.844f,  0.822f, 0.569f, 0.201f,
+    0.435f, 0.002f, 0.223f,  0.310f, 0.747f, 0.185f,  0.597f, 0.770f, 0.761f,  0.559f, 0.436f, 0.730f,
+    0.359f, 0.583f, 0.152f,  0.483f, 0.596f, 0.789f,  0.559f, 0.861f, 0.039f,  0.195f, 0.548f, 0.859f,
+    0.014f, 0.184f, 0.576f,  0.771f, 0.328f, 0.970f,  0.406f, 0.015f, 0.116f,  0.076f, 0.977f, 0.133f,
+    0.971f, 0.572f, 0.833f,  0.140f, 0.016f, 0.489f,  0.997f, 0.513f, 0.064f,  0.945f, 0.719f, 0.592f,
+    0.543f, 0.021f, 0.978f,  0.279f, 0.317f, 0.505f,  0.167f, 0.020f, 0.077f,  0.347f, 0.857f, 0.137f,
+};
 
-     0.820f,  0.883f,  0.371f,
+/* Cube of half-size x_length: 24 vertices (4 per face, so faces can differ in color) and 36 indices */
+VAO* createCube(double x_length,double /*y_length*/,double /*z_length*/)
+{
+    char key[32];
+    snprintf(key, sizeof(key), "cube %g", x_length);
+    if (meshCache.count(key))
+        return meshCache[key];
 
-     0.982f,  0.099f,  0.879f
+    GLfloat vertex_buffer_data[72];
+    for (int k=0; k<72; k++)
+        vertex_buffer_data[k] = x_length*cubeCorners[k];
 
- };
+    GLushort index_buffer_data[36];
+    for (int face=0; face<6; face++)
+        for (int k=0; k<6; k++)
+            index_buffer_data[6*face + k] = 4*face + faceIndices[k];
 
- cube[x][y] = create3DObject(GL_TRIANGLES, 36, vertex_buffer_data, color_buffer_data, GL_FILL);
+    return meshCache[key] = createIndexed3DObject(GL_TRIANGLES, 24, vertex_buffer_data, cubeColors, 36, index_buffer_data, GL_FILL);
 }
 
-void createPlayer(double x_length,double y_length,double z_length)
+/*********
+ * Level *
+ *********/
+
+// Text levels: optional '#' comment lines, a "width height" line, then one
+// line per row of tiles, top row (largest j) first: '.' floor, 'o' hole,
+// '^' moving block.
+// Binary levels: LEVEL_MAGIC, int32 width, int32 height, then the raw tiles
+// array (width*height bytes, i-major) so it can be read with one fread.
+const char LEVEL_MAGIC[4] = { 'L', '3', 'D', '1' };
+// tile indices are ints, so boards stay well below 2^31 tiles (16384x16384)
+const size_t MAX_BOARD_TILES = (size_t)1 << 28;
+
+/* Whether a width x height board fits, checked without overflowing int */
+inline bool validBoardSize(int width,int height)
 {
-	GLfloat vertex_buffer_data[] = {
-
-     -x_length,-x_length,-x_length, // triangle 1 : begin
-
-     -x_length,-x_length, x_length,
-
-     -x_length, x_length, x_length, // triangle 1 : end
-
-     x_length, x_length,-x_length, // triangle 2 : begin
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length,-x_length, // triangle 2 : end
-
-     x_length,-x_length, x_length,
-
-     -x_length,-x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length, x_length,
-
-     -x_length, x_length,-x_length,
-
-     x_length,-x_length, x_length,
-
-     -x_length,-x_length, x_length,
-
-     -x_length,-x_length,-x_length,
-
-     -x_length, x_length, x_length,
-
-     -x_length,-x_length, x_length,
-
-     x_length,-x_length, x_length,
-
-     x_length, x_length, x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length,-x_length,
-
-     x_length,-x_length,-x_length,
-
-     x_length, x_length, x_length,
+    return width > 0 && height > 0 && (size_t)width*height <= MAX_BOARD_TILES;
+}
 
-     x_length,-x_length, x_length,
+inline int tileIndex(int i,int j)
+{
+    return i*board_height + j;
+}
 
-     x_length, x_length, x_length,
+inline bool onBoard(int i,int j)
+{
+    return i >= 0 && j >= 0 && i < board_width && j < board_height;
+}
 
-     x_length, x_length,-x_length,
+inline int tileAt(int i,int j)
+{
+    return tiles[tileIndex(i,j)];
+}
 
-     -x_length, x_length,-x_length,
+/* Rebuild the list of moving blocks after the tiles array changed */
+void indexLevel()
+{
+    movingTiles.clear();
+    for (int k=0;k<board_width*board_height;k++)
+        if (tiles[k] == TILE_MOVING)
+            movingTiles.push_back(k);
+}
 
-     x_length, x_length, x_length,
+/* Built-in level: holes at (3,4) (7,7) (6,5), moving blocks at (5,5) (8,7) (9,8) */
+void makeDefaultLevel(int width,int height)
+{
+    static const int holes[][2] = { {3,4}, {7,7}, {6,5} };
+    static const int movingBlocks[][2] = { {5,5}, {8,7}, {9,8} };
+
+    board_width = width;
+    board_height = height;
+    tiles.assign((size_t)width*height, TILE_FLOOR);
+    for (int k=0;k<3;k++) {
+        if (onBoard(holes[k][0], holes[k][1]))
+            tiles[tileIndex(holes[k][0], holes[k][1])] = TILE_HOLE;
+        if (onBoard(movingBlocks[k][0], movingBlocks[k][1]))
+            tiles[tileIndex(movingBlocks[k][0], movingBlocks[k][1])] = TILE_MOVING;
+    }
+    indexLevel();
+}
 
-     -x_length, x_length,-x_length,
+bool loadLevelText(const char* path)
+{
+    std::ifstream in(path, std::ios::in);
+    if (!in.is_open())
+        return false;
+
+    std::string line;
+    while (getline(in, line) && (line.empty() || line[0] == '#'))
+        ;
+    int width = 0, height = 0;
+    if (sscanf(line.c_str(), "%d %d", &width, &height) != 2 || !validBoardSize(width, height))
+        return false;
+
+    board_width = width;
+    board_height = height;
+    tiles.assign((size_t)width*height, TILE_FLOOR);
+    for (int j=height-1; j>=0 && getline(in, line); j--)
+        for (int i=0; i<width && i<(int)line.size(); i++)
+            switch (line[i]) {
+                case 'o': tiles[tileIndex(i,j)] = TILE_HOLE; break;
+                case '^': tiles[tileIndex(i,j)] = TILE_MOVING; break;
+                default: break;
+            }
+    indexLevel();
+    return true;
+}
 
-     -x_length, x_length, x_length,
+/* Load a binary or text level, chosen by the file's first bytes */
+bool loadLevel(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL)
+        return false;
+
+    char magic[4];
+    if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LEVEL_MAGIC, 4) != 0) {
+        fclose(fp);
+        return loadLevelText(path);
+    }
 
-     x_length, x_length, x_length,
+    int32_t size[2];
+    if (fread(size, sizeof(int32_t), 2, fp) != 2 || !validBoardSize(size[0], size[1])) {
+        fclose(fp);
+        return false;
+    }
+    board_width = size[0];
+    board_height = size[1];
+    tiles.resize((size_t)board_width*board_height);
+    size_t read = fread(&tiles[0], 1, tiles.size(), fp);
+    fclose(fp);
+    if (read != tiles.size())
+        return false;
+
+    indexLevel();
+    return true;
+}
 
-     -x_length, x_length, x_length,
+bool saveLevel(const char* path)
+{
+    FILE* fp = fopen(path, "wb");
+    if (fp == NULL)
+        return false;
+
+    int32_t size[2] = { board_width, board_height };
+    bool ok = fwrite(LEVEL_MAGIC, 1, 4, fp) == 4 &&
+              fwrite(size, sizeof(int32_t), 2, fp) == 2 &&
+              fwrite(&tiles[0], 1, tiles.size(), fp) == tiles.size();
+    return fclose(fp) == 0 && ok;
+}
 
-     x_length,-x_length, x_length,
+/* Resting height of tile (i,j): sunk for holes, riding block_move for moving blocks */
+double tileHeight(int i,int j,double block_move)
+{
+    switch (tileAt(i,j)) {
+        case TILE_HOLE:
+            return -1;
+        case TILE_MOVING:
+            return block_move - 1.0f;
+        default:
+            return 0;
+    }
+}
 
- };
+/***********
+ * Culling *
+ ***********/
 
- GLfloat color_buffer_data[] = {
+// The board is tested against the frustum one chunk of CHUNK_SIZE x CHUNK_SIZE
+// tiles at a time. Since the visible part of the board is convex, the visible
+// chunks of each chunk column are contiguous, so what survives is one j-range
+// per tile column, and consecutive ranges that touch in tileIndex order are merged.
+const int CHUNK_SIZE = 32;
 
-     0.0,  0.0,  0.0,
+inline int chunkIndex(int ci,int cj)
+{
+    int chunks_y = (board_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    return ci*chunks_y + cj;
+}
 
-     0.0,  0.0,  0.0,
+struct TileRun {
+    int first, count;       // tileIndex range
+};
+vector<TileRun> visibleRuns;
+vector<int> visibleChunks;  // chunkIndex of every chunk in view
+int tiles_drawn = 0, tiles_culled = 0;
 
-     0.0,  0.0,  0.0,
+struct Frustum {
+    glm::vec4 planes[6];    // inside when dot(plane, (x,y,z,1)) >= 0
+};
 
-     0.0,  0.0,  0.0,
+/* Gribb/Hartmann plane extraction from a view-projection matrix */
+Frustum frustumFromVP (const glm::mat4& VP)
+{
+    Frustum frustum;
+    glm::vec4 row[4];
+    for (int r=0; r<4; r++)
+        row[r] = glm::vec4(VP[0][r], VP[1][r], VP[2][r], VP[3][r]);
+    for (int axis=0; axis<3; axis++) {
+        frustum.planes[2*axis] = row[3] + row[axis];
+        frustum.planes[2*axis + 1] = row[3] - row[axis];
+    }
+    return frustum;
+}
 
-     0.0,  0.0,  0.0,
+bool boxInFrustum (const Frustum& frustum, const AABB& box)
+{
+    for (int p=0; p<6; p++) {
+        const glm::vec4& plane = frustum.planes[p];
+        // the box corner furthest along the plane normal
+        double x = plane.x >= 0 ? box.max_x : box.min_x;
+        double y = plane.y >= 0 ? box.max_y : box.min_y;
+        double z = plane.z >= 0 ? box.max_z : box.min_z;
+        if (plane.x*x + plane.y*y + plane.z*z + plane.w < 0)
+            return false;
+    }
+    return true;
+}
 
-     0.0,  0.0,  0.0,
+/* Box around tiles [i0,i1] x [j0,j1] at any height they can reach */
+AABB boardRegionBox (int i0, int i1, int j0, int j1)
+{
+    // holes sink to -1, moving blocks rise to +1
+    AABB box = { -2 + i0/2.0 - TILE_HALF_SIZE, -2 + j0/2.0 - TILE_HALF_SIZE, -1 - TILE_HALF_SIZE,
+                 -2 + i1/2.0 + TILE_HALF_SIZE, -2 + j1/2.0 + TILE_HALF_SIZE,  1 + TILE_HALF_SIZE };
+    return box;
+}
 
-     0.0,  0.0,  0.0,
+void addVisibleRun (int first, int count)
+{
+    if (!visibleRuns.empty() && visibleRuns.back().first + visibleRuns.back().count == first)
+        visibleRuns.back().count += count;
+    else {
+        TileRun run = { first, count };
+        visibleRuns.push_back(run);
+    }
+}
 
-     0.0,  0.0,  0.0,
+/* Fill visibleRuns with the tiles the camera can see */
+void cullBoard (const glm::mat4& VP)
+{
+    visibleRuns.clear();
+    visibleChunks.clear();
+    Frustum frustum = frustumFromVP(VP);
+
+    for (int i0=0; i0<board_width; i0+=CHUNK_SIZE) {
+        int i1 = min(i0 + CHUNK_SIZE, board_width) - 1;
+
+        int first_j = -1, last_j = -1;
+        for (int j0=0; j0<board_height; j0+=CHUNK_SIZE) {
+            int j1 = min(j0 + CHUNK_SIZE, board_height) - 1;
+            if (!frustum_culling || boxInFrustum(frustum, boardRegionBox(i0, i1, j0, j1))) {
+                if (first_j < 0)
+                    first_j = j0;
+                last_j = j1;
+                visibleChunks.push_back(chunkIndex(i0/CHUNK_SIZE, j0/CHUNK_SIZE));
+            }
+        }
+        if (first_j < 0)
+            continue;
 
-     0.0,  0.0,  0.0,
+        for (int i=i0; i<=i1; i++)
+            addVisibleRun(tileIndex(i, first_j), last_j - first_j + 1);
+    }
 
-     0.0,  0.0,  0.0,
+    tiles_drawn = 0;
+    for (size_t r=0; r<visibleRuns.size(); r++)
+        tiles_drawn += visibleRuns[r].count;
+    tiles_culled = board_width*board_height - tiles_drawn;
+}
 
-     0.0,  0.0,  0.0,
+/****************
+ * Chunk meshes *
+ ****************/
+
+// With --merged every chunk is one mesh holding its static tiles, holes
+// included, instead of a cube instance per tile. Faces that can't be seen are
+// left out. The camera always looks down on the board, so no bottom faces are
+// built. A chunk further than LOD_DISTANCE from the eye gets a coarse mesh instead,
+// without the side faces towards a static neighbour at least as high. Those
+// show only through the 0.1 gap between tiles, which is under a pixel that far
+// away. Moving blocks change height, so they stay out of the meshes and are
+// drawn as one instanced cube.
+const double LOD_DISTANCE = 10;
+
+VAO* movingBlocks;          // one instance per movingTiles entry
+int chunks_coarse = 0;      // chunks drawn with their coarse mesh last frame
+
+/* Whether a neighbour at (ni,nj) hides the side of a static tile at height */
+bool sideCovered (int ni, int nj, double height)
+{
+    return onBoard(ni,nj) && tileAt(ni,nj) != TILE_MOVING && tileHeight(ni,nj,0) >= height;
+}
 
-     0.0,  0.0,  0.0,
+/* Mesh of the static tiles in [i0,i1) x [j0,j1), placed relative to tile (i0,j0) */
+/* A 32x32 chunk is at most 5120 faces of 4 vertices, so GLushort indices do */
+VAO* createChunkMesh (int i0, int i1, int j0, int j1, bool coarse)
+{
+    static const int sides[4][3] = { { FACE_NEG_X,-1,0 }, { FACE_POS_X,1,0 }, { FACE_NEG_Y,0,-1 }, { FACE_POS_Y,0,1 } };
+
+    vector<GLfloat> vertex_buffer_data, color_buffer_data;
+    vector<GLushort> index_buffer_data;
+    for (int i=i0;i<i1;i++)
+        for (int j=j0;j<j1;j++)
+        {
+            if (tileAt(i,j) == TILE_MOVING)
+                continue;
+            double height = tileHeight(i,j,0);
+
+            int faces = 1 << FACE_POS_Z;
+            for (int k=0;k<4;k++)
+                if (!coarse || !sideCovered(i + sides[k][1], j + sides[k][2], height))
+                    faces |= 1 << sides[k][0];
+
+            for (int face=0; face<6; face++) {
+                if (!(faces & (1 << face)))
+                    continue;
+                int first = vertex_buffer_data.size() / 3;
+                for (int k=0;k<6;k++)
+                    index_buffer_data.push_back(first + faceIndices[k]);
+                for (int v=4*face; v<4*face+4; v++) {
+                    vertex_buffer_data.push_back((i-i0)/2.0f + TILE_HALF_SIZE*cubeCorners[3*v]);
+                    vertex_buffer_data.push_back((j-j0)/2.0f + TILE_HALF_SIZE*cubeCorners[3*v + 1]);
+                    vertex_buffer_data.push_back(height + TILE_HALF_SIZE*cubeCorners[3*v + 2]);
+                    color_buffer_data.insert(color_buffer_data.end(), &cubeColors[3*v], &cubeColors[3*v + 3]);
+                }
+            }
+        }
+    if (index_buffer_data.empty())
+        return NULL;
 
-     0.0,  0.0,  0.0,
+    // a chunk is 16 units across: snorm16 can't hold that and half would be
+    // off by up to 1/128 at the far side, so chunk meshes are always floats
+    return createIndexed3DObject(NULL, &vertexLayouts[VERTEX_FLOAT], GL_TRIANGLES, vertex_buffer_data.size() / 3, &vertex_buffer_data[0], &color_buffer_data[0],
+                                 index_buffer_data.size(), &index_buffer_data[0], GL_FILL);
+}
 
-     0.0,  0.0,  0.0,
+/* The moving blocks as instances of the tile cube, moved by flushDirtyTiles */
+/* Used by --merged and --greedy-floor, which leave them out of their meshes */
+void createMovingBlocks ()
+{
+    movingBlocks = share3DObject(createCube(TILE_HALF_SIZE,1,1));
+
+    vector<GLfloat> offset_buffer_data;
+    for (size_t k=0; k<movingTiles.size(); k++) {
+        int i = movingTiles[k] / board_height, j = movingTiles[k] % board_height;
+        offset_buffer_data.push_back(-2+i/2.0f);
+        offset_buffer_data.push_back(-2+j/2.0f);
+        offset_buffer_data.push_back(tileHeight(i,j,render_state.block_move));
+    }
+    if (!movingTiles.empty())
+        setInstanceOffsets(movingBlocks, movingTiles.size(), &offset_buffer_data[0]);
+}
 
-     0.0,  0.0,  0.0,
+/**********
+ * Chunks *
+ **********/
+
+// The instanced board lives on the GPU as one VAO per chunk, sharing the tile
+// cube and holding the offsets of the chunk's tiles. A chunk is uploaded the
+// first time it comes into view and freed once it has been out of view for
+// CHUNK_IDLE_FRAMES, so GPU memory and startup time follow what the camera
+// sees instead of the board size. Only the one-byte tile table is board sized.
+const int CHUNK_IDLE_FRAMES = 120;
+// spread the uploads over frames when a lot of the board comes into view at once
+const int CHUNK_UPLOADS_PER_FRAME = 8;
+
+// With --merged a chunk keeps only the mesh for the distance it was last drawn at
+enum ChunkLod { LOD_NONE, LOD_NEAR, LOD_COARSE };
+
+struct Chunk {
+    VAO* vao;               // tile instances, or with --merged the mesh for lod
+    ChunkLod lod;           // --merged: which mesh vao is, LOD_NONE until first drawn
+    bool resident;
+    int last_visible;       // chunk_frame the chunk was last in view
+};
+vector<Chunk> chunks;       // indexed by chunkIndex(ci,cj)
+vector<int> residentChunks;
+int chunk_frame = 0;
+int chunks_uploaded = 0, chunks_freed = 0, chunks_lod_switches = 0;
 
-     0.0,  0.0,  0.0,
+/* Tiles [i0,i1) x [j0,j1) covered by chunk (ci,cj) */
+void chunkBounds (int ci, int cj, int& i0, int& i1, int& j0, int& j1)
+{
+    i0 = ci*CHUNK_SIZE;
+    j0 = cj*CHUNK_SIZE;
+    i1 = min(i0 + CHUNK_SIZE, board_width);
+    j1 = min(j0 + CHUNK_SIZE, board_height);
+}
 
-     0.0,  0.0,  0.0,
+/* Instance number of tile (i,j) in its chunk's offset buffer */
+int chunkInstance (int i, int j)
+{
+    int j0 = j - j%CHUNK_SIZE;
+    int chunk_height = min(CHUNK_SIZE, board_height - j0);
+    return (i%CHUNK_SIZE)*chunk_height + (j - j0);
+}
 
-     0.0,  0.0,  0.0,
+void uploadChunk (int c)
+{
+    int chunks_y = (board_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    int i0, i1, j0, j1;
+    chunkBounds(c / chunks_y, c % chunks_y, i0, i1, j0, j1);
+
+    chunks[c].resident = true;
+    residentChunks.push_back(c);
+    chunks_uploaded++;
+
+    // the mesh is built by drawMergedChunks once it knows the chunk's distance
+    if (merged_chunks)
+        return;
+
+    vector<GLfloat> offset_buffer_data;
+    offset_buffer_data.reserve(3*(i1-i0)*(j1-j0));
+    for (int i=i0;i<i1;i++)
+        for (int j=j0;j<j1;j++)
+        {
+            offset_buffer_data.push_back(-2+i/2.0f);
+            offset_buffer_data.push_back(-2+j/2.0f);
+            offset_buffer_data.push_back(tileHeight(i,j,render_state.block_move));
+        }
 
-     0.0,  0.0,  0.0,
+    chunks[c].vao = share3DObject(grid);
+    setInstanceOffsets(chunks[c].vao, (i1-i0)*(j1-j0), &offset_buffer_data[0]);
+}
 
-     0.0,  0.0,  0.0,
+void freeChunk (int c)
+{
+    Chunk& chunk = chunks[c];
+    if (!merged_chunks)
+        delete3DObject(chunk.vao);
+    else if (chunk.vao)
+        free3DObject(chunk.vao);
+    chunk.vao = NULL;
+    chunk.lod = LOD_NONE;
+    chunk.resident = false;
+    chunks_freed++;
+}
 
-     0.0,  0.0,  0.0,
+/* Make the visible chunks resident and free the ones that left view a while ago */
+void streamChunks ()
+{
+    chunk_frame++;
+
+    int uploads = 0;
+    for (size_t k=0; k<visibleChunks.size(); k++) {
+        Chunk& chunk = chunks[visibleChunks[k]];
+        chunk.last_visible = chunk_frame;
+        if (!chunk.resident && uploads < CHUNK_UPLOADS_PER_FRAME) {
+            uploadChunk(visibleChunks[k]);
+            uploads++;
+        }
+    }
 
-     0.0,  0.0,  0.0,
+    for (size_t k=0; k<residentChunks.size(); ) {
+        int c = residentChunks[k];
+        if (chunk_frame - chunks[c].last_visible > CHUNK_IDLE_FRAMES) {
+            freeChunk(c);
+            residentChunks[k] = residentChunks.back();
+            residentChunks.pop_back();
+        }
+        else
+            k++;
+    }
+}
 
-     0.0,  0.0,  0.0,
+/* Count only the tiles of visible chunks that are resident: one still waiting
+   for its upload isn't drawn this frame, so it counts as culled */
+void countResidentTiles ()
+{
+    int chunks_y = (board_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    tiles_drawn = 0;
+    for (size_t k=0; k<visibleChunks.size(); k++) {
+        int c = visibleChunks[k];
+        if (!chunks[c].resident)
+            continue;
+        int i0, i1, j0, j1;
+        chunkBounds(c / chunks_y, c % chunks_y, i0, i1, j0, j1);
+        tiles_drawn += (i1-i0)*(j1-j0);
+    }
+    tiles_culled = board_width*board_height - tiles_drawn;
+}
 
-     0.0,  0.0,  0.0,
+// Creates the shared tile cube; the chunks using it are streamed in by draw()
+void createGrid ()
+{
+    grid = createCube(TILE_HALF_SIZE,1,1);
 
-     0.0,  0.0,  0.0,
+    int chunks_x = (board_width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    int chunks_y = (board_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    Chunk empty = { NULL, LOD_NONE, false, 0 };
+    chunks.assign(chunks_x*chunks_y, empty);
+}
 
-     0.0,  0.0,  0.0,
+/* Draw the visible --merged chunks, coarse when their nearest point is over LOD_DISTANCE away.
+   A resident chunk builds its mesh on its first draw and rebuilds it when it crosses LOD_DISTANCE */
+void drawMergedChunks (const glm::vec3& eye)
+{
+    int chunks_y = (board_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunks_coarse = 0;
+    for (size_t k=0; k<visibleChunks.size(); k++) {
+        int c = visibleChunks[k];
+        int i0, i1, j0, j1;
+        chunkBounds(c / chunks_y, c % chunks_y, i0, i1, j0, j1);
+
+        AABB box = boardRegionBox(i0, i1-1, j0, j1-1);
+        double dx = max(0.0, max(box.min_x - eye.x, eye.x - box.max_x));
+        double dy = max(0.0, max(box.min_y - eye.y, eye.y - box.max_y));
+        double dz = max(0.0, max(box.min_z - eye.z, eye.z - box.max_z));
+        bool distant = dx*dx + dy*dy + dz*dz > LOD_DISTANCE*LOD_DISTANCE;
+
+        Chunk& chunk = chunks[c];
+        if (!chunk.resident)
+            continue;
+        ChunkLod lod = distant ? LOD_COARSE : LOD_NEAR;
+        if (chunk.lod != lod) {
+            if (chunk.lod != LOD_NONE)
+                chunks_lod_switches++;
+            if (chunk.vao)
+                free3DObject(chunk.vao);
+            // NULL when every tile of the chunk is a moving block
+            chunk.vao = createChunkMesh(i0, i1, j0, j1, distant);
+            chunk.lod = lod;
+        }
+        if (chunk.vao == NULL)
+            continue;
+        chunks_coarse += distant;
+        glUniform3f(Matrices.OffsetID, -2+i0/2.0f, -2+j0/2.0f, 0);
+        gl_calls++;
+        draw3DObject(chunk.vao);
+    }
+}
 
-     0.0,  0.0,  0.0,
+/****************
+ * Static floor *
+ ****************/
+
+// With --greedy-floor the static tiles (floor and holes) are baked at level
+// load into one vertex buffer and drawn with one call; the moving blocks are
+// the instanced movingBlocks. Each greedy rectangle of tiles at one height
+// becomes a single top quad. The quads cover the gaps between tiles, and
+// their corners take the tile cube's colors. Walls are only built where the
+// board steps down, merged along runs of tiles, and reach down to the lower
+// tile's top or, at the board edge and next to moving blocks, to where the
+// cube's bottom was.
+int floor_quads = 0;
+
+/* Append one face of box as two triangles, in the cube face's vertex order and colors */
+void appendBoxFace (vector<GLfloat>& vertex_buffer_data, vector<GLfloat>& color_buffer_data, const AABB& box, int face)
+{
+    for (int k=0; k<6; k++) {
+        int v = 4*face + faceIndices[k];
+        vertex_buffer_data.push_back(cubeCorners[3*v] < 0 ? box.min_x : box.max_x);
+        vertex_buffer_data.push_back(cubeCorners[3*v + 1] < 0 ? box.min_y : box.max_y);
+        vertex_buffer_data.push_back(cubeCorners[3*v + 2] < 0 ? box.min_z : box.max_z);
+        color_buffer_data.insert(color_buffer_data.end(), &cubeColors[3*v], &cubeColors[3*v + 3]);
+    }
+    floor_quads++;
+}
 
-     0.0,  0.0,  0.0,
+/* Tiles cover their whole 0.5 cell, except at the board edge where the cube ended */
+double cellEdge (int i, int side, int size)
+{
+    bool board_edge = (side < 0 && i == 0) || (side > 0 && i == size-1);
+    return -2 + i/2.0 + side*(board_edge ? TILE_HALF_SIZE : 0.25);
+}
 
-     0.0,  0.0,  0.0,
+/* Bottom of the wall on the side of static tile (i,j) towards (ni,nj), or its top if there is none */
+double wallBottom (int i, int j, int ni, int nj)
+{
+    double top = tileHeight(i,j,0) + TILE_HALF_SIZE;
+    if (!onBoard(ni,nj) || tileAt(ni,nj) == TILE_MOVING)
+        return top - 2*TILE_HALF_SIZE;
+    return min(top, tileHeight(ni,nj,0) + TILE_HALF_SIZE);
+}
 
-     0.0,  0.0,  0.0,
+/* Greedy mesh of every static tile; leaves staticFloor NULL if there are none */
+void createFloor ()
+{
+    vector<GLfloat> vertex_buffer_data, color_buffer_data;
+    vector<bool> done(tiles.size(), false);
+    floor_quads = 0;
+
+    // tops: grow each rectangle along j, then along i while whole rows match
+    for (int i=0;i<board_width;i++)
+        for (int j=0;j<board_height;j++)
+        {
+            int type = tileAt(i,j);
+            if (type == TILE_MOVING || done[tileIndex(i,j)])
+                continue;
+            int j1 = j;
+            while (j1+1 < board_height && tileAt(i,j1+1) == type && !done[tileIndex(i,j1+1)])
+                j1++;
+            int i1 = i;
+            for (bool grow = true; grow && i1+1 < board_width; ) {
+                for (int jj=j; jj<=j1 && grow; jj++)
+                    grow = tileAt(i1+1,jj) == type && !done[tileIndex(i1+1,jj)];
+                if (grow)
+                    i1++;
+            }
+            for (int ii=i; ii<=i1; ii++)
+                for (int jj=j; jj<=j1; jj++)
+                    done[tileIndex(ii,jj)] = true;
+
+            double top = tileHeight(i,j,0) + TILE_HALF_SIZE;
+            AABB box = { cellEdge(i, -1, board_width), cellEdge(j, -1, board_height), top,
+                         cellEdge(i1, 1, board_width), cellEdge(j1, 1, board_height), top };
+            appendBoxFace(vertex_buffer_data, color_buffer_data, box, FACE_POS_Z);
+        }
 
-     0.0,  0.0,  0.0,
+    // walls: for each side, runs of tiles along it that need the same wall
+    static const int sides[4][3] = { { FACE_NEG_X,-1,0 }, { FACE_POS_X,1,0 }, { FACE_NEG_Y,0,-1 }, { FACE_POS_Y,0,1 } };
+    for (int s=0; s<4; s++) {
+        int di = sides[s][1], dj = sides[s][2];
+        bool along_j = di != 0;     // x walls run along j, y walls along i
+        int lines = along_j ? board_width : board_height;
+        int length = along_j ? board_height : board_width;
+        for (int line=0; line<lines; line++)
+            for (int k=0; k<length; )
+            {
+                int i = along_j ? line : k, j = along_j ? k : line;
+                double top = tileHeight(i,j,0) + TILE_HALF_SIZE;
+                double bottom = wallBottom(i, j, i+di, j+dj);
+                if (tileAt(i,j) == TILE_MOVING || bottom >= top) {
+                    k++;
+                    continue;
+                }
+                int end = k;
+                while (end+1 < length) {
+                    int ni = along_j ? line : end+1, nj = along_j ? end+1 : line;
+                    if (tileAt(ni,nj) == TILE_MOVING || tileHeight(ni,nj,0) + TILE_HALF_SIZE != top ||
+                        wallBottom(ni, nj, ni+di, nj+dj) != bottom)
+                        break;
+                    end++;
+                }
+
+                AABB box;
+                box.min_z = bottom;
+                box.max_z = top;
+                if (along_j) {
+                    box.min_x = box.max_x = cellEdge(line, di, board_width);
+                    box.min_y = cellEdge(k, -1, board_height);
+                    box.max_y = cellEdge(end, 1, board_height);
+                }
+                else {
+                    box.min_y = box.max_y = cellEdge(line, dj, board_height);
+                    box.min_x = cellEdge(k, -1, board_width);
+                    box.max_x = cellEdge(end, 1, board_width);
+                }
+                appendBoxFace(vertex_buffer_data, color_buffer_data, box, sides[s][0]);
+                k = end + 1;
+            }
+    }
 
-     0.0,  0.0,  0.0,
+    staticFloor = NULL;
+    if (vertex_buffer_data.empty())
+        return;
+    // world positions across the whole board need full floats whatever --vertex-format says
+    staticFloor = create3DObject(&level_arena, &vertexLayouts[VERTEX_FLOAT], GL_TRIANGLES, vertex_buffer_data.size() / 3,
+                                 &vertex_buffer_data[0], &color_buffer_data[0], GL_FILL);
+}
 
-     0.0,  0.0,  0.0,
+/***************
+ * Dirty tiles *
+ ***************/
+
+// Tile offsets are baked once, when a chunk is uploaded or (without
+// --instanced) in tileOffsets. Afterwards only the tiles queued in dirtyTiles
+// are rewritten, which is the moving blocks on frames where block_move changed,
+// so the per-frame CPU cost follows the number of moving tiles.
+vector<GLfloat> tileOffsets;    // 3 per tile, by tileIndex; per-tile path only
+vector<int> dirtyTiles;
+double baked_block_move = -1;   // block_move the moving tiles were last written with
+int tiles_updated = 0;
+
+// Creates the tile cube drawn once per tile, and bakes every tile's offset
+void createTiles ()
+{
+    tile = createCube(TILE_HALF_SIZE,1,1);
+
+    tileOffsets.resize(3*board_width*board_height);
+    for (int i=0;i<board_width;i++)
+        for (int j=0;j<board_height;j++)
+        {
+            GLfloat* offset = &tileOffsets[3*tileIndex(i,j)];
+            offset[0] = -2+i/2.0f;
+            offset[1] = -2+j/2.0f;
+            offset[2] = tileHeight(i,j,render_state.block_move);
+        }
+    baked_block_move = render_state.block_move;
+}
 
-     0.0,  0.0,  0.0,
+/* Queue the moving blocks if block_move changed since they were last written */
+void markMovingTiles (double block_move)
+{
+    if (block_move == baked_block_move)
+        return;
+    dirtyTiles.insert(dirtyTiles.end(), movingTiles.begin(), movingTiles.end());
+    baked_block_move = block_move;
+}
 
-     0.0,  0.0,  0.0,
+/* Write the offsets of the queued tiles into the chunks or tileOffsets */
+void flushDirtyTiles (double block_move)
+{
+    tiles_updated = dirtyTiles.size();
+    for (size_t k=0; k<dirtyTiles.size(); k++) {
+        int i = dirtyTiles[k] / board_height, j = dirtyTiles[k] % board_height;
+        GLfloat height = tileHeight(i,j,block_move);
+        if (movingBlocks) {
+            int instance = lower_bound(movingTiles.begin(), movingTiles.end(), dirtyTiles[k]) - movingTiles.begin();
+            updateInstanceOffset(movingBlocks, instance, -2+i/2.0f, -2+j/2.0f, height);
+        }
+        else if (instanced_grid) {
+            // chunks that are not resident get the current height when uploaded
+            VAO* chunk = chunks[chunkIndex(i/CHUNK_SIZE, j/CHUNK_SIZE)].vao;
+            if (chunk)
+                updateInstanceOffset(chunk, chunkInstance(i,j), -2+i/2.0f, -2+j/2.0f, height);
+        }
+        else
+            tileOffsets[3*dirtyTiles[k] + 2] = height;
+    }
+    dirtyTiles.clear();
+}
 
-     0.0,  0.0,  0.0
+// The player is the tile cube drawn in black
+void createPlayer(double x_length,double y_length,double z_length)
+{
+    VAO* cube = createCube(x_length,y_length,z_length);
 
- };
+    vector<GLfloat> color_buffer_data(3*cube->NumVertices, 0.0f);
+    player = recolor3DObject(cube, &color_buffer_data[0]);
+}
 
- player = create3DObject(GL_TRIANGLES, 36, vertex_buffer_data, color_buffer_data, GL_FILL);	
+// Agents are the player cube in orange, drawn instanced
+void createAgents(double x_length,double y_length,double z_length)
+{
+    VAO* cube = createCube(x_length,y_length,z_length);
 
+    vector<GLfloat> color_buffer_data(3*cube->NumVertices);
+    for (int v=0; v<cube->NumVertices; v++) {
+        color_buffer_data[3*v] = 1.0f;
+        color_buffer_data[3*v + 1] = 0.5f;
+        color_buffer_data[3*v + 2] = 0.0f;
+    }
+    agents = recolor3DObject(cube, &color_buffer_data[0]);
 }
 
 
@@ -733,12 +2160,16 @@ float triangle_rotation = 0;
 /* Edit this function according to your assignment */
 void draw ()
 {
+  gl_calls = gl_calls_skipped = 0;
+  triangles_drawn = 0;
+
   // clear the color and depth in the frame buffer
   glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  gl_calls++;
 
-  // use the loaded shader program
+  // objects are drawn grouped by program: modelOffset ones first, then instanced ones
   // Don't change unless you know what you are doing
-  glUseProgram (programID);
+  useProgram (programID);
 
   // Eye - Location of camera. Don't change unless you are sure!!
   glm::vec3 eye (eye_x, eye_y, eye_z);
@@ -757,10 +2188,13 @@ void draw ()
   //  Don't change unless you are sure!!
   glm::mat4 VP = Matrices.projection * Matrices.view;
 
-  // Send our transformation to the currently bound shader, in the "MVP" uniform
-  // For each model you render, since the MVP will be different (at least the M part)
-  //  Don't change unless you are sure!!
-  glm::mat4 MVP;	// MVP = Projection * View * Model
+  // VP goes to every program through the Camera uniform block; each object only
+  // sends its translation (a "modelOffset" uniform or an instance attribute)
+  updateCamera(VP);
+
+  // the greedy floor and its moving blocks are drawn whole, so there is nothing to cull
+  if (!greedy_floor)
+    cullBoard(VP);
 
   // Load identity to model matrix
   // Matrices.model = glm::mat4(1.0f);
@@ -793,54 +2227,39 @@ void draw ()
 
   // // draw3DObject draws the VAO given to it using current MVP matrix
   // draw3DObject(rectangle);
-  	glm::mat4 translateCube[11][11];
-  	glm::mat4 rotateCube[11][11];
-
-
-// hole at i=3,j=4 and i=6,j=5 and i=7,j=7
-// tiles moving up and down at i=2,j=6 and i=5,j=8  	
-    double holes[10][2] = { {3,4}, {7,7}, {6,5} };          //contains info about holes 
-    double movingBlocks[10][2] = { {5,5}, {8,7}, {9,8} };
-
-
-	for (int i=0;i<10;i++){
-		for (int j=0;j<10;j++)	
+  if (instanced_grid) {
+    streamChunks();
+    countResidentTiles();
+  }
+
+  // only the moving blocks change, every other offset stays as baked
+  markMovingTiles(render_state.block_move);
+  flushDirtyTiles(render_state.block_move);
+
+  if (greedy_floor)
+  {
+    // the baked floor is one draw of the whole board
+    tiles_drawn = board_width*board_height;
+    tiles_culled = 0;
+    if (staticFloor) {
+        glUniform3f(Matrices.OffsetID, 0, 0, 0);
+        gl_calls++;
+        draw3DObject(staticFloor);
+    }
+  }
+  else if (!instanced_grid)
+  {
+	for (size_t r=0;r<visibleRuns.size();r++){
+		for (int k=visibleRuns[r].first;k<visibleRuns[r].first+visibleRuns[r].count;k++)	
 		{
-		  Matrices.model = glm::mat4(1.0f);
-		  translateCube[i][j] = glm::translate (glm::vec3(-2+i/2.0f, -2+j/2.0f, 0));        // glTranslatef
-            for (int k=0;k<3;k++)   
-                if (holes[k][0] == i && holes[k][1] == j)
-                    translateCube[i][j] = glm::translate (glm::vec3(-2+i/2.0f, -2+j/2.0f, -1));        // glTranslatef\
-
-            for (int k=0;k<3;k++)   
-                if (movingBlocks[k][0] == i && movingBlocks[k][1] == j)
-                    translateCube[i][j] = glm::translate (glm::vec3(-2+i/2.0f, -2+j/2.0f, (blockMove - 1.0f )));       // glTranslatef\
-
-        rotateCube[i][j] = glm::rotate((float)(0*rectangle_rotation*M_PI/180.0f), glm::vec3(0,0,1)); // rotate about vector (-1,1,1)
-
-		  Matrices.model *= (translateCube[i][j] * rotateCube[i][j]);
-		  MVP = VP * Matrices.model;
-		  glUniformMatrix4fv(Matrices.MatrixID, 1, GL_FALSE, &MVP[0][0]);
-		  draw3DObject(cube[i][j]);
+		  glUniform3fv(Matrices.OffsetID, 1, &tileOffsets[3*k]);
+		  gl_calls++;
+		  draw3DObject(tile);
 		}
 	}
-    
-    for (int i=0;i<3;i++)
-    {
-        if ( (holes[i][0]/2.0f - 2) == player_x_coordinate && (holes[i][1]/2.0f - 2) == player_y_coordinate )
-            player_z_coordinate = -1;
-        if ( (movingBlocks[i][0]/2.0f - 2) == player_x_coordinate && 
-            (movingBlocks[i][1]/2.0f - 2) == player_y_coordinate )
-            if (player_z_coordinate < blockMove)
-                player_x_coordinate = player_y_coordinate = -2;
-            else
-            {
-               onBlock = 1;
-               int blockNo = i; 
-               player_z_coordinate = 1;
-            }
-    }
-
+  }
+  else if (merged_chunks)
+    drawMergedChunks(eye);
 
 	// if (player_x_coordinate == -0.5 && player_y_coordinate==0)
 		// player_z_coordinate = -1;
@@ -850,14 +2269,41 @@ void draw ()
 		// player_z_coordinate = -1;
 
 
-	Matrices.model = glm::mat4(1.0f);
-	glm::mat4 translatePlayer = glm::translate (glm::vec3(player_x_coordinate, player_y_coordinate, player_z_coordinate));        // glTranslatef
-	glm::mat4 rotatePlayer = glm::rotate((float)(0*rectangle_rotation*M_PI/180.0f), glm::vec3(0,0,1)); // rotate about vector (-1,1,1)
-	Matrices.model *= (translatePlayer * rotatePlayer);
-	MVP = VP * Matrices.model;
-	glUniformMatrix4fv(Matrices.MatrixID, 1, GL_FALSE, &MVP[0][0]);
+	glUniform3f(Matrices.OffsetID, render_state.x[PLAYER], render_state.y[PLAYER], render_state.z[PLAYER]);
+	gl_calls++;
 	draw3DObject(player);
 
+  useProgram (instancedProgramID);
+
+  if (movingBlocks)
+  {
+    if (movingBlocks->NumInstances > 0)
+        draw3DObjectInstanced(movingBlocks);
+  }
+  else if (instanced_grid)
+  {
+    for (size_t k=0;k<visibleChunks.size();k++)
+    {
+        VAO* chunk = chunks[visibleChunks[k]].vao;
+        if (chunk)
+            draw3DObjectInstanced(chunk);
+    }
+  }
+
+  // all agents in one instanced draw, positions streamed in every frame
+  if (entities.count > 1)
+  {
+    int numAgents = entities.count - 1;
+    static vector<GLfloat> agent_offsets;
+    agent_offsets.resize(3*numAgents);
+    for (int e=1; e<entities.count; e++) {
+        agent_offsets[3*(e-1)] = render_state.x[e];
+        agent_offsets[3*(e-1) + 1] = render_state.y[e];
+        agent_offsets[3*(e-1) + 2] = render_state.z[e];
+    }
+    setInstanceOffsets(agents, numAgents, &agent_offsets[0]);
+    draw3DObjectInstanced(agents);
+  }
 
   // Increment angles
   float increments = 1;
@@ -867,12 +2313,48 @@ void draw ()
   rectangle_rotation = rectangle_rotation + increments*rectangle_rot_dir*rectangle_rot_status;
 }
 
+/* Build the models of the current level, all owned by level_arena */
+void createLevelObjects ()
+{
+    if (greedy_floor)
+        createFloor();
+    else if (instanced_grid)
+        createGrid();
+    else
+        createTiles();
+    if (merged_chunks || greedy_floor)
+        createMovingBlocks();
+    createPlayer(PLAYER_HALF_SIZE,1,1);
+    createAgents(PLAYER_HALF_SIZE,1,1);
+}
+
+/* Release every model of the current level */
+void freeLevelObjects ()
+{
+    for (size_t k=0; k<residentChunks.size(); k++)
+        freeChunk(residentChunks[k]);
+    residentChunks.clear();
+    chunks.clear();
+    if (movingBlocks) {
+        delete3DObject(movingBlocks);
+        movingBlocks = NULL;
+    }
+
+    meshCache.clear();
+    vector<GLfloat>().swap(tileOffsets);
+    dirtyTiles.clear();
+    grid = tile = staticFloor = player = agents = NULL;
+
+    freeArena(level_arena);
+}
+
 /* Initialise glfw window, I/O callbacks and the renderer to use */
 /* Nothing to Edit here */
 GLFWwindow* initGLFW (int width, int height)
 {
     GLFWwindow* window; // window desciptor/handle
 
+    double start = monotonicTime();
     glfwSetErrorCallback(error_callback);
     if (!glfwInit()) {
         exit(EXIT_FAILURE);
@@ -883,6 +2365,10 @@ GLFWwindow* initGLFW (int width, int height)
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    // benchmark runs render offscreen into a hidden window's back buffer
+    if (bench_frames > 0)
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
     window = glfwCreateWindow(width, height, "Sample OpenGL 3.3 Application", NULL, NULL);
 
     if (!window) {
@@ -891,8 +2377,12 @@ GLFWwindow* initGLFW (int width, int height)
     }
 
     glfwMakeContextCurrent(window);
+    timeStartup("window", start);
+
+    start = monotonicTime();
     gladLoadGLLoader((GLADloadproc) glfwGetProcAddress);
-    glfwSwapInterval( 1 );
+    timeStartup("GL loader", start);
+    applyPresentMode();
 
     /* --- register callbacks with GLFW --- */
 
@@ -921,19 +2411,27 @@ void initGL (GLFWwindow* window, int width, int height)
 {
     /* Objects should be created before any other gl function and shaders */
 	// Create the models
-    for (int i=0;i<10;i++){
-		for (int j=0;j<10;j++){
-			createCube(0.2,1,1,i,j);
-		}
-	}
-	createPlayer(0.2,1,1);
+    double start = monotonicTime();
+    createLevelObjects();
+    timeStartup("level objects", start);
+
 	// Create and compile our GLSL program from the shaders
+    start = monotonicTime();
 	programID = LoadShaders( "Sample_GL.vert", "Sample_GL.frag" );
-	// Get a handle for our "MVP" uniform
-	Matrices.MatrixID = glGetUniformLocation(programID, "MVP");
+	// Get a handle for our "modelOffset" uniform
+	Matrices.OffsetID = glGetUniformLocation(programID, "modelOffset");
+
+	// used by the instanced grid and the agents
+	instancedProgramID = LoadShaders( "Sample_GL_instanced.vert", "Sample_GL.frag" );
+    timeStartup("shaders", start);
+
+	initCamera();
+	bindCameraBlock(programID);
+	bindCameraBlock(instancedProgramID);
 
 	
 	reshapeWindow (window, width, height);
+	initGpuTimers();
 
     // Background color of the scene
 	glClearColor (0.3f, 0.3f, 0.3f, 0.0f); // R, G, B, A
@@ -946,78 +2444,786 @@ void initGL (GLFWwindow* window, int width, int height)
     cout << "RENDERER: " << glGetString(GL_RENDERER) << endl;
     cout << "VERSION: " << glGetString(GL_VERSION) << endl;
     cout << "GLSL: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << endl;
+    cout << "VERTEX FORMAT: " << vertexLayouts[vertex_format].Name << ", " << vertexLayouts[vertex_format].Stride << " bytes/vertex" << endl;
+    reportStartup();
+}
+
+/************
+ * Entities *
+ ************/
+
+int spawnEntity(float x,float y,float vx,float vy)
+{
+    entities.x.push_back(x);
+    entities.y.push_back(y);
+    entities.z.push_back(0);
+    entities.vx.push_back(vx);
+    entities.vy.push_back(vy);
+    entities.jump.push_back(0);
+    entities.jump_base.push_back(0);
+    entities.on_block.push_back(0);
+    return entities.count++;
+}
+
+/* Uniform random number in [0,1) from a small LCG, so spawns are the same every run */
+float nextRandom(uint32_t& seed)
+{
+    seed = seed*1664525u + 1013904223u;
+    return (seed >> 8) / 16777216.0f;
+}
+
+/* Scatter n agents over the board, each walking in a random direction */
+void spawnAgents(int n)
+{
+    uint32_t seed = 12345;
+    for (int k=0; k<n; k++) {
+        float x = -2 + (board_width-1)/2.0f * nextRandom(seed);
+        float y = -2 + (board_height-1)/2.0f * nextRandom(seed);
+        float angle = 2*M_PI * nextRandom(seed);
+        spawnEntity(x, y, cos(angle), sin(angle));
+    }
+}
+
+/* Height a jump has reached with the given ticks left: 0.4 per tick up for the
+ * first 2 ticks, then back down */
+inline float jumpHeight(float jump)
+{
+    return 0.4f*min(4 - jump, jump);
 }
 
+/* Advance one jump by ticks. z is set from the jump phase rather than stepped
+ * by a rate, so a step across the top or the landing can't overshoot and the
+ * jump lands exactly where it started at any --sim-hz. */
+inline void advanceJump(float& z, float& jump, float base, float ticks)
+{
+    float left = max(jump - ticks, 0.0f);
+    z = jump > 0 ? base + jumpHeight(left) : z;
+    jump = left;
+}
+
+/* Move entity e to height z without ending the jump it may be in */
+void placeEntity(int e, float z)
+{
+    entities.z[e] = z;
+    entities.jump_base[e] = z - jumpHeight(entities.jump[e]);
+}
+
+/* Move every entity and advance its jump by dt seconds */
+void updateEntities(double dt)
+{
+    const int n = entities.count;
+    const float fdt = dt, ticks = dt / GAME_TICK;
+    float* __restrict x = &entities.x[0];
+    float* __restrict y = &entities.y[0];
+    float* __restrict z = &entities.z[0];
+    const float* __restrict vx = &entities.vx[0];
+    const float* __restrict vy = &entities.vy[0];
+    float* __restrict jump = &entities.jump[0];
+    const float* __restrict jump_base = &entities.jump_base[0];
+
+    for (int e=0; e<n; e++) {
+        x[e] += vx[e]*fdt;
+        y[e] += vy[e]*fdt;
+    }
+
+    for (int e=0; e<n; e++)
+        advanceJump(z[e], jump[e], jump_base[e], ticks);
+}
+
+/* Keep every entity on the board; agents bounce off the edges */
 void dontLetOut()
 {
-    if (player_x_coordinate < -2 )
-        player_x_coordinate = -2;
-    if (player_y_coordinate < -2)
-        player_y_coordinate = -2;
-    if (player_x_coordinate > 2.5 )
-        player_x_coordinate = 2.5;
-    if (player_y_coordinate > 2.5)
-        player_y_coordinate = 2.5;
-    
+    const int n = entities.count;
+    const float edge_x = -2 + (board_width-1)/2.0f, edge_y = -2 + (board_height-1)/2.0f;
+    float* __restrict x = &entities.x[0];
+    float* __restrict y = &entities.y[0];
+    float* __restrict vx = &entities.vx[0];
+    float* __restrict vy = &entities.vy[0];
+
+    for (int e=0; e<n; e++) {
+        float cx = min(max(x[e], -2.0f), edge_x);
+        float cy = min(max(y[e], -2.0f), edge_y);
+        vx[e] = cx != x[e] ? -vx[e] : vx[e];
+        vy[e] = cy != y[e] ? -vy[e] : vy[e];
+        x[e] = cx;
+        y[e] = cy;
+    }
+}
+
+/*************
+ * Collision *
+ *************/
+
+/* Grid cell whose 0.5 x 0.5 footprint contains a world coordinate */
+inline int cellOf(double coord)
+{
+    // floor() without the libm call
+    double v = (coord + 2)*2 + 0.5;
+    int cell = (int)v;
+    return cell - (v < cell);
+}
+
+AABB cubeBox(double x,double y,double z,double half)
+{
+    AABB box = { x-half, y-half, z-half, x+half, y+half, z+half };
+    return box;
+}
+
+/* Solid box of the tile cube at (i,j) */
+AABB tileBox(int i,int j,double block_move)
+{
+    return cubeBox(-2+i/2.0, -2+j/2.0, tileHeight(i,j,block_move), TILE_HALF_SIZE);
+}
+
+/* Area of the xy overlap of two boxes, 0 if they don't overlap */
+double overlapXY(const AABB& a,const AABB& b)
+{
+    double w = min(a.max_x, b.max_x) - max(a.min_x, b.min_x);
+    double h = min(a.max_y, b.max_y) - max(a.min_y, b.min_y);
+    return (w > 0 && h > 0) ? w*h : 0;
+}
+
+/* Resolve an entity against holes and moving blocks.
+ * Only the cells its box can reach are tested - at most 2x2 since entities
+ * are smaller than a cell - so the cost doesn't depend on board size.
+ * The tile under most of the entity is the one it stands on. */
+void collideWithTiles(float& x,float& y,float& z,float& on_block,double half)
+{
+    AABB box = cubeBox(x, y, z, half);
+    int i0 = max(cellOf(box.min_x), 0), i1 = min(cellOf(box.max_x), board_width-1);
+    int j0 = max(cellOf(box.min_y), 0), j1 = min(cellOf(box.max_y), board_height-1);
+
+    // most of the board is plain floor, which never affects an entity
+    bool special = false;
+    for (int i=i0; i<=i1; i++)
+        for (int j=j0; j<=j1; j++)
+            special |= tileAt(i,j) != TILE_FLOOR;
+    if (!special)
+        return;
+
+    int support = -1;
+    double support_area = 0;
+
+    for (int i=i0; i<=i1; i++)
+        for (int j=j0; j<=j1; j++)
+        {
+            double area = overlapXY(box, tileBox(i,j,blockMove));
+            if (area <= 0)
+                continue;
+
+            // running into a raised block sends the entity back to the start
+            if (tileAt(i,j) == TILE_MOVING && z < blockMove) {
+                x = y = -2;
+                return;
+            }
+            if (area > support_area) {
+                support_area = area;
+                support = tileIndex(i,j);
+            }
+        }
+
+    if (support < 0)
+        return;
+
+    switch (tiles[support]) {
+        case TILE_HOLE:
+            z = -1;
+            break;
+        case TILE_MOVING:
+            on_block = 1;
+            z = 1;
+            break;
+        default:
+            break;
+    }
+}
+
+/* Resolve every entity against holes and moving blocks */
+void checkCollisions()
+{
+    for (int e=0; e<entities.count; e++) {
+        float z = entities.z[e];
+        collideWithTiles(entities.x[e], entities.y[e], z, entities.on_block[e], PLAYER_HALF_SIZE);
+        // a hole or block mid-jump moves where the rest of the jump is measured from
+        if (z != entities.z[e])
+            placeEntity(e, z);
+    }
+}
+
+/* Advance entities and moving blocks by dt seconds */
+void updateGame(double dt)
+{
+    updateEntities(dt);
+
+    blockMove += 0.2f*(dt / GAME_TICK);
+    if (blockMove > 2)
+        blockMove = 0;
+}
+
+/* One fixed simulation step */
+void stepSimulation(double dt)
+{
+    sim_step++;
+    applyInput();
+    updateGame(dt);
+    dontLetOut();
+    checkCollisions();
+}
+
+void captureState(RenderState& state)
+{
+    state.step = sim_step;
+    state.block_move = blockMove;
+    state.x = entities.x;
+    state.y = entities.y;
+    state.z = entities.z;
+}
+
+/* Blend two consecutive steps; alpha is how far we are into the next step */
+void interpolateState(const RenderState& a, const RenderState& b, double alpha, RenderState& state)
+{
+    state.step = b.step;
+
+    // blocks snap back to the bottom instead of sliding down through the floor
+    if (b.block_move < a.block_move)
+        state.block_move = b.block_move;
+    else
+        state.block_move = a.block_move + (b.block_move - a.block_move)*alpha;
+
+    const int n = b.x.size();
+    const float t = alpha;
+    state.x.resize(n);
+    state.y.resize(n);
+    state.z.resize(n);
+    for (int e=0; e<n; e++) {
+        state.x[e] = a.x[e] + (b.x[e] - a.x[e])*t;
+        state.y[e] = a.y[e] + (b.y[e] - a.y[e])*t;
+        state.z[e] = a.z[e] + (b.z[e] - a.z[e])*t;
+    }
+}
+
+/*********************
+ * Simulation thread *
+ *********************/
+
+// With --sim-thread the simulation steps on its own thread at sim_hz and
+// publishes snapshots of its last two steps through a triple buffer: the
+// simulation fills the back slot and swaps it with the middle one, the renderer
+// swaps the middle slot for its front one when a newer snapshot is there. Both
+// swaps are single atomic exchanges, so neither side ever waits for the other.
+struct SimSnapshot {
+    RenderState previous, current;
+    double time;            // monotonicTime() at which 'current' is due
+    long steps;             // steps simulated so far
+};
+SimSnapshot snapshots[3];
+const int SNAPSHOT_FRESH = 4;   // set in snapshot_middle when it holds an unread snapshot
+int snapshot_back = 0, snapshot_middle = 1, snapshot_front = 2;
+
+pthread_t sim_thread;
+bool sim_thread_running = false;
+int sim_thread_quit = 0;
+
+void publishSnapshot()
+{
+    snapshot_back = __atomic_exchange_n(&snapshot_middle, snapshot_back | SNAPSHOT_FRESH, __ATOMIC_ACQ_REL) & 3;
+}
+
+/* Latest snapshot the simulation published; stays valid until the next call */
+const SimSnapshot& consumeSnapshot()
+{
+    if (__atomic_load_n(&snapshot_middle, __ATOMIC_RELAXED) & SNAPSHOT_FRESH)
+        snapshot_front = __atomic_exchange_n(&snapshot_middle, snapshot_front, __ATOMIC_ACQ_REL) & 3;
+    return snapshots[snapshot_front];
+}
+
+void* simulationThread(void*)
+{
+    double sim_dt = 1.0 / sim_hz;
+    double next_step = monotonicTime();
+    RenderState previous_state, current_state;
+    captureState(current_state);
+    long steps = 0;
+
+    while (!__atomic_load_n(&sim_thread_quit, __ATOMIC_ACQUIRE)) {
+        double now = monotonicTime();
+        next_step = max(next_step, now - 0.25); // don't try to catch up after a long stall
+
+        if (next_step <= now) {
+            ScopedTimer timer("simulation", TRACK_SIM);
+            while (next_step <= now) {
+                swap(previous_state, current_state);
+                stepSimulation(sim_dt);
+                captureState(current_state);
+                next_step += sim_dt;
+                steps++;
+            }
+
+            SimSnapshot& snapshot = snapshots[snapshot_back];
+            snapshot.previous = previous_state;
+            snapshot.current = current_state;
+            snapshot.time = next_step - sim_dt;
+            snapshot.steps = steps;
+            publishSnapshot();
+        }
+
+        struct timespec wake;
+        wake.tv_sec = (time_t)next_step;
+        wake.tv_nsec = (long)((next_step - wake.tv_sec)*1e9);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+    }
+    return NULL;
+}
+
+void startSimulationThread()
+{
+    for (int k=0; k<3; k++) {
+        captureState(snapshots[k].current);
+        snapshots[k].previous = snapshots[k].current;
+        snapshots[k].time = monotonicTime();
+        snapshots[k].steps = 0;
+    }
+
+    if (pthread_create(&sim_thread, NULL, simulationThread, NULL) != 0) {
+        fprintf(stderr, "Error: can't start the simulation thread\n");
+        exit(EXIT_FAILURE);
+    }
+    sim_thread_running = true;
+}
+
+/* Also registered with atexit, so the thread is gone before the profiler reports */
+void stopSimulationThread()
+{
+    if (!sim_thread_running)
+        return;
+    __atomic_store_n(&sim_thread_quit, 1, __ATOMIC_RELEASE);
+    pthread_join(sim_thread, NULL);
+    sim_thread_running = false;
+}
+
+/**********
+ * Replay *
+ **********/
+
+// Recordings: REPLAY_MAGIC, int32 board width and height, uint64 hash of the
+// tile table, int32 agent count, double sim_hz, int64 steps, uint64 hash of the
+// final state, int32 input count, then per input an int32 step and an int8
+// action. The simulation is deterministic from there, so replaying the inputs
+// on the same level must end in the same state.
+const char REPLAY_MAGIC[4] = { 'R', '3', 'D', '1' };
+
+struct Recording {
+    int32_t board_width, board_height;
+    uint64_t level_hash;
+    int32_t agents;
+    double sim_hz;
+    int64_t steps;
+    uint64_t state_hash;
+    vector<InputRecord> inputs;
+};
+
+uint64_t levelHash()
+{
+    int32_t size[2] = { board_width, board_height };
+    return hashBytes(&tiles[0], tiles.size(), hashBytes(size, sizeof(size)));
+}
+
+/* Everything the simulation carries from one step to the next */
+uint64_t stateHash()
+{
+    int64_t step = sim_step;
+    uint64_t hash = hashBytes(&step, sizeof(step));
+    hash = hashBytes(&blockMove, sizeof(blockMove), hash);
+    const vector<float>* fields[] = { &entities.x, &entities.y, &entities.z, &entities.vx, &entities.vy, &entities.jump, &entities.jump_base, &entities.on_block };
+    for (int f=0; f<8; f++)
+        hash = hashBytes(&(*fields[f])[0], fields[f]->size()*sizeof(float), hash);
+    return hash;
+}
+
+/* Registered with atexit when recording, after the simulation thread has stopped */
+void writeRecording()
+{
+    FILE* fp = fopen(record_path, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "Error: can't write recording %s\n", record_path);
+        return;
+    }
+
+    int32_t size[2] = { board_width, board_height };
+    uint64_t level_hash = levelHash(), state_hash = stateHash();
+    int32_t agents = entities.count - 1;
+    int64_t steps = sim_step;
+    int32_t count = recorded_inputs.size();
+    bool ok = fwrite(REPLAY_MAGIC, 1, 4, fp) == 4 &&
+              fwrite(size, sizeof(int32_t), 2, fp) == 2 &&
+              fwrite(&level_hash, sizeof(level_hash), 1, fp) == 1 &&
+              fwrite(&agents, sizeof(agents), 1, fp) == 1 &&
+              fwrite(&sim_hz, sizeof(sim_hz), 1, fp) == 1 &&
+              fwrite(&steps, sizeof(steps), 1, fp) == 1 &&
+              fwrite(&state_hash, sizeof(state_hash), 1, fp) == 1 &&
+              fwrite(&count, sizeof(count), 1, fp) == 1;
+    for (int k=0; ok && k<count; k++) {
+        int8_t action = recorded_inputs[k].action;
+        ok = fwrite(&recorded_inputs[k].step, sizeof(int32_t), 1, fp) == 1 &&
+             fwrite(&action, 1, 1, fp) == 1;
+    }
+    if (fclose(fp) != 0 || !ok)
+        fprintf(stderr, "Error: can't write recording %s\n", record_path);
+    else
+        printf("recorded %d inputs over %ld steps to %s\n", count, sim_step, record_path);
+}
+
+bool loadRecording(const char* path, Recording& recording)
+{
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL)
+        return false;
+
+    char magic[4];
+    int32_t size[2], count;
+    bool ok = fread(magic, 1, 4, fp) == 4 && memcmp(magic, REPLAY_MAGIC, 4) == 0 &&
+              fread(size, sizeof(int32_t), 2, fp) == 2 &&
+              fread(&recording.level_hash, sizeof(recording.level_hash), 1, fp) == 1 &&
+              fread(&recording.agents, sizeof(recording.agents), 1, fp) == 1 &&
+              fread(&recording.sim_hz, sizeof(recording.sim_hz), 1, fp) == 1 &&
+              fread(&recording.steps, sizeof(recording.steps), 1, fp) == 1 &&
+              fread(&recording.state_hash, sizeof(recording.state_hash), 1, fp) == 1 &&
+              fread(&count, sizeof(count), 1, fp) == 1 &&
+              count >= 0 && recording.agents >= 0 && recording.sim_hz > 0 &&
+              size[0] > 0 && size[1] > 0 && recording.steps >= 0;
+    recording.board_width = size[0];
+    recording.board_height = size[1];
+
+    // inputs are applied on steps 1..steps in order; several can share a step
+    recording.inputs.clear();
+    int32_t last_step = 1;
+    for (int k=0; ok && k<count; k++) {
+        InputRecord record;
+        int8_t action;
+        ok = fread(&record.step, sizeof(int32_t), 1, fp) == 1 &&
+             fread(&action, 1, 1, fp) == 1 &&
+             record.step >= last_step && record.step <= recording.steps;
+        record.action = action;
+        last_step = record.step;
+        recording.inputs.push_back(record);
+    }
+    fclose(fp);
+    return ok;
+}
+
+/* A jump has to land exactly where it took off at any step rate, or entities
+ * creep off the floor a little more with every jump */
+bool checkJumps()
+{
+    const double rates[] = { 60, 120, 144 };
+    const float starts[] = { 0, 1, -1, 0.37f };
+    bool ok = true;
+    for (int r=0; r<3; r++)
+        for (int k=0; k<4; k++) {
+            float z = starts[k], jump = 4, ticks = 1.0 / rates[r] / GAME_TICK;
+            while (jump > 0)
+                advanceJump(z, jump, starts[k], ticks);
+            if (z != starts[k]) {
+                fprintf(stderr, "Error: a jump from z=%g at %.0f Hz lands at z=%.9g\n", starts[k], rates[r], z);
+                ok = false;
+            }
+        }
+    return ok;
+}
+
+/* --replay: step through a recording without a window as fast as possible; true if the final state matches */
+bool runReplay(const Recording& recording)
+{
+    double dt = 1.0 / sim_hz;
+    size_t next_input = 0;
+    double start = monotonicTime();
+    while (sim_step < recording.steps) {
+        // the same point in the step where applyInput() would have applied them
+        while (next_input < recording.inputs.size() && recording.inputs[next_input].step <= sim_step + 1)
+            applyPlayerAction(recording.inputs[next_input++].action);
+        stepSimulation(dt);
+    }
+    double elapsed = monotonicTime() - start;
+
+    uint64_t hash = stateHash();
+    bool jumps_ok = checkJumps();
+    printf("replayed %ld steps, %d inputs, %d entities in %.3f s (%.0f steps/s)\n", sim_step,
+           (int)recording.inputs.size(), entities.count, elapsed, sim_step / max(elapsed, 1e-9));
+    printf("state hash %016llx, recorded %016llx: %s\n", (unsigned long long)hash,
+           (unsigned long long)recording.state_hash, hash == recording.state_hash ? "match" : "MISMATCH");
+    printf("jumps at 60, 120 and 144 Hz land where they started: %s\n", jumps_ok ? "yes" : "NO");
+    return hash == recording.state_hash && jumps_ok;
+}
+
+bool parseVertexFormat(const char* name)
+{
+    for (int f=0; f<3; f++)
+        if (strcmp(name, vertexLayouts[f].Name) == 0) {
+            vertex_format = (VertexFormat)f;
+            return true;
+        }
+    return false;
 }
 
+/* --bench-sim: run the simulation alone, without a window, and report per-entity cost */
+void benchSimulation(int steps)
+{
+    double dt = 1.0 / sim_hz;
+    vector<double> step_times;
+    for (int k=0; k<steps; k++) {
+        double start = monotonicTime();
+        stepSimulation(dt);
+        step_times.push_back(monotonicTime() - start);
+    }
+
+    printf("%d steps, %d entities, %dx%d board\n", steps, entities.count, board_width, board_height);
+    reportTimes("step", step_times);
+    printf("per entity %.1f ns (median step)\n", 1e9*step_times[step_times.size()/2]/entities.count);
+}
 
 int main (int argc, char** argv)
 {
 	int width = 600;
 	int height = 600;
 
+    int board_size = 10;
+    const char *level_path = NULL, *save_level_path = NULL, *replay_path = NULL;
+    int bench_sim_steps = 0;
+
+    for (int i=1;i<argc;i++) {
+        if (strcmp(argv[i], "--instanced") == 0)
+            instanced_grid = true;
+        else if (strcmp(argv[i], "--merged") == 0)
+            merged_chunks = instanced_grid = true;
+        else if (strcmp(argv[i], "--greedy-floor") == 0)
+            greedy_floor = true;
+        else if (strcmp(argv[i], "--no-cull") == 0)
+            frustum_culling = false;
+        else if (strcmp(argv[i], "--board") == 0 && i+1 < argc)
+            board_size = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--level") == 0 && i+1 < argc)
+            level_path = argv[++i];
+        else if (strcmp(argv[i], "--save-level") == 0 && i+1 < argc)
+            save_level_path = argv[++i];
+        else if (strcmp(argv[i], "--bench") == 0 && i+1 < argc)
+            bench_frames = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--profile") == 0)
+            profiling = true;
+        else if (strcmp(argv[i], "--trace") == 0 && i+1 < argc)
+            trace_path = argv[++i];
+        else if (strcmp(argv[i], "--agents") == 0 && i+1 < argc)
+            agent_count = max(0, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--bench-sim") == 0 && i+1 < argc)
+            bench_sim_steps = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--sim-hz") == 0 && i+1 < argc)
+            sim_hz = max(1.0, atof(argv[++i]));
+        else if (strcmp(argv[i], "--sim-thread") == 0)
+            sim_threaded = true;
+        else if (strcmp(argv[i], "--present") == 0 && i+1 < argc && parsePresentMode(argv[i+1]))
+            i++;
+        else if (strcmp(argv[i], "--fps-limit") == 0 && i+1 < argc)
+            fps_limit = max(1.0, atof(argv[++i]));
+        else if (strcmp(argv[i], "--record") == 0 && i+1 < argc)
+            record_path = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i+1 < argc)
+            replay_path = argv[++i];
+        else if (strcmp(argv[i], "--vertex-format") == 0 && i+1 < argc && parseVertexFormat(argv[i+1]))
+            i++;
+        else {
+            fprintf(stderr, "usage: %s [--instanced] [--merged] [--greedy-floor] [--no-cull] [--board N] [--level FILE] [--save-level FILE] [--bench FRAMES] [--bench-sim STEPS] [--profile] [--trace FILE] [--agents N] [--sim-hz HZ] [--sim-thread] [--record FILE] [--replay FILE] [--present vsync|adaptive|uncapped] [--fps-limit FPS] [--vertex-format float|half|snorm16]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // the baked floor replaces the chunked board
+    if (greedy_floor)
+        instanced_grid = merged_chunks = false;
+
+    if (level_path == NULL) {
+        if (!validBoardSize(board_size, board_size)) {
+            fprintf(stderr, "Error: a %dx%d board is too large\n", board_size, board_size);
+            exit(EXIT_FAILURE);
+        }
+        makeDefaultLevel(board_size, board_size);
+    }
+    else if (!loadLevel(level_path)) {
+        fprintf(stderr, "Error: can't load level %s\n", level_path);
+        exit(EXIT_FAILURE);
+    }
+
+    // convert the level to the binary format and stop
+    if (save_level_path != NULL) {
+        if (!saveLevel(save_level_path)) {
+            fprintf(stderr, "Error: can't write level %s\n", save_level_path);
+            exit(EXIT_FAILURE);
+        }
+        exit(EXIT_SUCCESS);
+    }
+
+    // benchmarks report through the profiler
+    if (trace_path != NULL || bench_frames > 0)
+        profiling = true;
+    atexit(finishProfiling);
+
+    // a replay runs with the agents and step rate it was recorded with
+    Recording recording;
+    if (replay_path != NULL) {
+        if (!loadRecording(replay_path, recording)) {
+            fprintf(stderr, "Error: can't load recording %s\n", replay_path);
+            exit(EXIT_FAILURE);
+        }
+        if (recording.level_hash != levelHash()) {
+            fprintf(stderr, "Error: %s was recorded on a different %dx%d level\n", replay_path, recording.board_width, recording.board_height);
+            exit(EXIT_FAILURE);
+        }
+        agent_count = recording.agents;
+        sim_hz = recording.sim_hz;
+    }
+
+    spawnEntity(-2, -2, 0, 0); // the player
+    spawnAgents(agent_count);
+
+    if (replay_path != NULL)
+        exit(runReplay(recording) ? EXIT_SUCCESS : EXIT_FAILURE);
+
+    if (bench_sim_steps > 0) {
+        benchSimulation(bench_sim_steps);
+        exit(EXIT_SUCCESS);
+    }
+
     GLFWwindow* window = initGLFW(width, height);
 
 	initGL (window, width, height);
 
     double last_update_time = glfwGetTime(), current_time;
 
+    // fixed-step simulation: render time is fed into an accumulator and
+    // drained in whole steps, the remainder is used to interpolate
+    double sim_dt = 1.0 / sim_hz;
+    double accumulator = 0, previous_time = monotonicTime();
+    RenderState previous_state, current_state;
+    captureState(current_state);
+    previous_state = current_state;
+    long total_steps = 0;
+
+    atexit(reportInputLatency);
+    atexit(reportFrameRate);
+    if (record_path != NULL)
+        atexit(writeRecording);
+
+    if (sim_threaded) {
+        startSimulationThread();
+        atexit(stopSimulationThread);
+    }
+
+    int frame = 0;
+
     /* Draw in loop */
     while (!glfwWindowShouldClose(window)) {
 
-        dontLetOut();
+        double frame_start = monotonicTime();
+
+        if (rebuild_level) {
+            freeLevelObjects();
+            createLevelObjects();
+            rebuild_level = false;
+        }
+
+        // benchmark frames always advance the same simulated time (60 fps)
+        // the clock is read once per frame, so no time slips between frames
+        double elapsed = bench_frames > 0 ? 1.0/60 : frame_start - previous_time;
+        previous_time = frame_start;
+        accumulator += min(elapsed, 0.25); // don't try to catch up after a long stall
+
+        if (sim_threaded) {
+            // draw the snapshot 'alpha' of a step after its newest state, as below
+            const SimSnapshot& snapshot = consumeSnapshot();
+            double alpha = min(1.0, max(0.0, (monotonicTime() - snapshot.time) / sim_dt));
+            interpolateState(snapshot.previous, snapshot.current, alpha, render_state);
+            total_steps = snapshot.steps;
+        }
+        else {
+            ScopedTimer timer("simulation");
+            while (accumulator >= sim_dt) {
+                swap(previous_state, current_state);
+                stepSimulation(sim_dt);
+                captureState(current_state);
+                accumulator -= sim_dt;
+                total_steps++;
+            }
+            interpolateState(previous_state, current_state, accumulator / sim_dt, render_state);
+        }
+
         // OpenGL Draw commands
-        draw();
+        beginGpuTimer();
+        {
+            ScopedTimer timer("draw");
+            draw();
+        }
+        endGpuTimer();
 
         // if (player_z_coordinate == -1)
             // quit(window);
 
         // Swap Frame Buffer in double buffering
-        glfwSwapBuffers(window);
+        {
+            ScopedTimer timer("swap");
+            glfwSwapBuffers(window);
+        }
+
+        measureInputLatency(render_state.step, monotonicTime());
+
+        // wait out the frame limit before polling, so input is as fresh as possible
+        paceFrame();
 
         // Poll for Keyboard and mouse events
         glfwPollEvents();
 
-        // Control based on time (Time based transformation like 5 degrees rotation every 0.5s)
         current_time = glfwGetTime(); // Time in seconds
-        int countb=1;
 
-        if ((current_time - last_update_time) >= 0.5) { // atleast 0.5s elapsed since last frame
-            // do something every 0.5 seconds ..
-            if (playerJump > 0)
-            {
-                if (playerJump > 2)
-                    player_z_coordinate += 0.4;
-                else
-                    player_z_coordinate -= 0.4;
+        recordTiming("frame", TRACK_CPU, frame_start, monotonicTime() - frame_start);
 
-                playerJump -= 1;
-            }
-//            if (countb % 20 == 0)
-            {
-                blockMove += 0.2f;
-                if (blockMove > 2)
-                    blockMove = 0;
+        frame++;
 
-            }
+        // --profile: the culling counters of every frame, not just the periodic summary
+        if (profiling && bench_frames == 0)
+            printf("frame %d: tiles drawn :%d culled :%d\n", frame, tiles_drawn, tiles_culled);
 
+        if (bench_frames > 0) {
+            if (frame >= bench_frames)
+                break;
+        }
+        else if ((current_time - last_update_time) >= 0.5) { // atleast 0.5s elapsed since last frame
             printf("player level :%d\n",player_level);
+            printf("tiles drawn :%d culled :%d updated :%d triangles :%d\n",tiles_drawn,tiles_culled,tiles_updated,triangles_drawn);
+            printf("gl calls :%d skipped :%d\n",gl_calls,gl_calls_skipped);
+            if (instanced_grid)
+                printf("chunks resident :%d coarse :%d\n",(int)residentChunks.size(),chunks_coarse);
             last_update_time = current_time;
         }
 
     }
 
+    stopSimulationThread();
+
+    if (bench_frames > 0) {
+        // the per-phase min/median/p99 are printed by finishProfiling
+        printf("%d frames, %dx%d board%s, %.0f Hz simulation\n", frame, board_width, board_height, merged_chunks ? ", merged" : instanced_grid ? ", instanced" : greedy_floor ? ", greedy floor" : "", sim_hz);
+        printf("last frame: %d tiles drawn, %d culled, %d updated, %d triangles, %d GL calls, %d skipped\n", tiles_drawn, tiles_culled, tiles_updated, triangles_drawn, gl_calls, gl_calls_skipped);
+        if (greedy_floor)
+            printf("floor: %d quads, %d vertices\n", floor_quads, staticFloor ? staticFloor->NumVertices : 0);
+        if (instanced_grid)
+            printf("chunks: %d resident, %d uploaded, %d freed, %d coarse, %d LOD switches\n", (int)residentChunks.size(), chunks_uploaded, chunks_freed, chunks_coarse, chunks_lod_switches);
+
+        vector<double>& sim_times = timing_samples["simulation"];
+        double total_sim_time = 0;
+        for (size_t k=0; k<sim_times.size(); k++)
+            total_sim_time += sim_times[k];
+        if (total_steps > 0)
+            printf("simulation per entity per step %.1f ns, %d entities\n", 1e9*total_sim_time/total_steps/entities.count, entities.count);
+    }
+
+    freeLevelObjects();
     glfwTerminate();
     exit(EXIT_SUCCESS);
 }
@@ -0,0 +1,27 @@
+#version 330 core
+
+// input data : sent from main program
+layout (location = 0) in vec3 vertexPosition;
+layout (location = 1) in vec3 vertexColor;
+layout (location = 2) in vec3 instanceOffset; // one per instance (tile)
+
+// shared by all programs, updated once per frame
+layout (std140) uniform Camera {
+    mat4 VP;
+};
+
+// output data : used by fragment shader
+out vec3 fragColor;
+
+void main ()
+{
+    // Each instance is the shared mesh translated to its own tile
+    vec4 v = vec4(vertexPosition + instanceOffset, 1);
+
+    // The color of each vertex will be interpolated
+    // to produce the color of each fragment
+    fragColor = vertexColor;
+
+    // Output position of the vertex, in clip space : VP * position
+    gl_Position = VP * v;
+}
@@ -139,82 +139,128 @@ struct gladGLversionStruct GLVersion;
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static const char **exts_i = NULL;
+/* The driver's extensions, hashed once by get_exts() so has_ext() is a
+ * single probe instead of a scan of the whole list per query. Entries point
+ * into strings owned by the GL (the GL_EXTENSIONS string or glGetStringi()),
+ * which stay valid while the context lives. */
+struct gladExtensionEntry {
+    const char *name;
+    size_t length;
+};
+
+static struct gladExtensionEntry *ext_set = NULL;
+static size_t ext_set_mask = 0;
+
+static size_t hash_ext(const char *name, size_t length) {
+    size_t hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void insert_ext(const char *name, size_t length) {
+    size_t slot = hash_ext(name, length) & ext_set_mask;
+    while(ext_set[slot].name != NULL) {
+        if(ext_set[slot].length == length && memcmp(ext_set[slot].name, name, length) == 0) {
+            return;
+        }
+        slot = (slot + 1) & ext_set_mask;
+    }
+    ext_set[slot].name = name;
+    ext_set[slot].length = length;
+}
+
+/* Sizes the table to at least twice the extension count, a power of two */
+static int alloc_ext_set(size_t count) {
+    size_t capacity = 16;
+    while(capacity < 2 * count) {
+        capacity *= 2;
+    }
+    free(ext_set);
+    ext_set = (struct gladExtensionEntry *)calloc(capacity, sizeof *ext_set);
+    ext_set_mask = capacity - 1;
+    return ext_set != NULL;
+}
 
 static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *p;
+        size_t count = 0;
+
+        if(exts == NULL) {
+            return alloc_ext_set(0);
+        }
+        for(p = exts; *p != '\0'; p++) {
+            if(*p != ' ' && (p == exts || p[-1] == ' ')) {
+                count++;
+            }
+        }
+        if(!alloc_ext_set(count)) {
+            return 0;
+        }
+        p = exts;
+        while(*p != '\0') {
+            size_t length = strcspn(p, " ");
+            if(length > 0) {
+                insert_ext(p, length);
+            }
+            p += length;
+            while(*p == ' ') {
+                p++;
+            }
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         int index;
+        int num_exts_i = 0;
 
-        num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (const char **)realloc((void *)exts_i, num_exts_i * sizeof *exts_i);
-        }
-
-        if (exts_i == NULL) {
+        if(!alloc_ext_set(num_exts_i > 0 ? num_exts_i : 0)) {
             return 0;
         }
 
         for(index = 0; index < num_exts_i; index++) {
-            exts_i[index] = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            const char *e = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(e != NULL) {
+                insert_ext(e, strlen(e));
+            }
         }
     }
 #endif
     return 1;
 }
 
+#ifndef GLAD_TRIMMED
+/* the trimmed loader keeps the set for gladLoadGLExtension() instead */
 static void free_exts(void) {
-    if (exts_i != NULL) {
-        free(exts_i);
-        exts_i = NULL;
+    if (ext_set != NULL) {
+        free(ext_set);
+        ext_set = NULL;
     }
 }
-
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
+static int has_ext(const char *ext) {
+    size_t length, slot;
 
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+    if(ext_set == NULL || ext == NULL) {
+        return 0;
+    }
 
-            if(strcmp(e, ext) == 0) {
-                return 1;
-            }
+    length = strlen(ext);
+    slot = hash_ext(ext, length) & ext_set_mask;
+    while(ext_set[slot].name != NULL) {
+        if(ext_set[slot].length == length && memcmp(ext_set[slot].name, ext, length) == 0) {
+            return 1;
         }
+        slot = (slot + 1) & ext_set_mask;
     }
-#endif
 
     return 0;
 }
@@ -6895,551 +6941,637 @@ static void load_GL_SUN_vertex(GLADloadproc load) {
 	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)load("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN");
 	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)load("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN");
 }
-static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	GLAD_GL_3DFX_multisample = has_ext("GL_3DFX_multisample");
-	GLAD_GL_3DFX_tbuffer = has_ext("GL_3DFX_tbuffer");
-	GLAD_GL_3DFX_texture_compression_FXT1 = has_ext("GL_3DFX_texture_compression_FXT1");
-	GLAD_GL_AMD_blend_minmax_factor = has_ext("GL_AMD_blend_minmax_factor");
-	GLAD_GL_AMD_conservative_depth = has_ext("GL_AMD_conservative_depth");
-	GLAD_GL_AMD_debug_output = has_ext("GL_AMD_debug_output");
-	GLAD_GL_AMD_depth_clamp_separate = has_ext("GL_AMD_depth_clamp_separate");
-	GLAD_GL_AMD_draw_buffers_blend = has_ext("GL_AMD_draw_buffers_blend");
-	GLAD_GL_AMD_gcn_shader = has_ext("GL_AMD_gcn_shader");
-	GLAD_GL_AMD_gpu_shader_int64 = has_ext("GL_AMD_gpu_shader_int64");
-	GLAD_GL_AMD_interleaved_elements = has_ext("GL_AMD_interleaved_elements");
-	GLAD_GL_AMD_multi_draw_indirect = has_ext("GL_AMD_multi_draw_indirect");
-	GLAD_GL_AMD_name_gen_delete = has_ext("GL_AMD_name_gen_delete");
-	GLAD_GL_AMD_occlusion_query_event = has_ext("GL_AMD_occlusion_query_event");
-	GLAD_GL_AMD_performance_monitor = has_ext("GL_AMD_performance_monitor");
-	GLAD_GL_AMD_pinned_memory = has_ext("GL_AMD_pinned_memory");
-	GLAD_GL_AMD_query_buffer_object = has_ext("GL_AMD_query_buffer_object");
-	GLAD_GL_AMD_sample_positions = has_ext("GL_AMD_sample_positions");
-	GLAD_GL_AMD_seamless_cubemap_per_texture = has_ext("GL_AMD_seamless_cubemap_per_texture");
-	GLAD_GL_AMD_shader_atomic_counter_ops = has_ext("GL_AMD_shader_atomic_counter_ops");
-	GLAD_GL_AMD_shader_stencil_export = has_ext("GL_AMD_shader_stencil_export");
-	GLAD_GL_AMD_shader_trinary_minmax = has_ext("GL_AMD_shader_trinary_minmax");
-	GLAD_GL_AMD_sparse_texture = has_ext("GL_AMD_sparse_texture");
-	GLAD_GL_AMD_stencil_operation_extended = has_ext("GL_AMD_stencil_operation_extended");
-	GLAD_GL_AMD_texture_texture4 = has_ext("GL_AMD_texture_texture4");
-	GLAD_GL_AMD_transform_feedback3_lines_triangles = has_ext("GL_AMD_transform_feedback3_lines_triangles");
-	GLAD_GL_AMD_transform_feedback4 = has_ext("GL_AMD_transform_feedback4");
-	GLAD_GL_AMD_vertex_shader_layer = has_ext("GL_AMD_vertex_shader_layer");
-	GLAD_GL_AMD_vertex_shader_tessellator = has_ext("GL_AMD_vertex_shader_tessellator");
-	GLAD_GL_AMD_vertex_shader_viewport_index = has_ext("GL_AMD_vertex_shader_viewport_index");
-	GLAD_GL_APPLE_aux_depth_stencil = has_ext("GL_APPLE_aux_depth_stencil");
-	GLAD_GL_APPLE_client_storage = has_ext("GL_APPLE_client_storage");
-	GLAD_GL_APPLE_element_array = has_ext("GL_APPLE_element_array");
-	GLAD_GL_APPLE_fence = has_ext("GL_APPLE_fence");
-	GLAD_GL_APPLE_float_pixels = has_ext("GL_APPLE_float_pixels");
-	GLAD_GL_APPLE_flush_buffer_range = has_ext("GL_APPLE_flush_buffer_range");
-	GLAD_GL_APPLE_object_purgeable = has_ext("GL_APPLE_object_purgeable");
-	GLAD_GL_APPLE_rgb_422 = has_ext("GL_APPLE_rgb_422");
-	GLAD_GL_APPLE_row_bytes = has_ext("GL_APPLE_row_bytes");
-	GLAD_GL_APPLE_specular_vector = has_ext("GL_APPLE_specular_vector");
-	GLAD_GL_APPLE_texture_range = has_ext("GL_APPLE_texture_range");
-	GLAD_GL_APPLE_transform_hint = has_ext("GL_APPLE_transform_hint");
-	GLAD_GL_APPLE_vertex_array_object = has_ext("GL_APPLE_vertex_array_object");
-	GLAD_GL_APPLE_vertex_array_range = has_ext("GL_APPLE_vertex_array_range");
-	GLAD_GL_APPLE_vertex_program_evaluators = has_ext("GL_APPLE_vertex_program_evaluators");
-	GLAD_GL_APPLE_ycbcr_422 = has_ext("GL_APPLE_ycbcr_422");
-	GLAD_GL_ARB_ES2_compatibility = has_ext("GL_ARB_ES2_compatibility");
-	GLAD_GL_ARB_ES3_1_compatibility = has_ext("GL_ARB_ES3_1_compatibility");
-	GLAD_GL_ARB_ES3_2_compatibility = has_ext("GL_ARB_ES3_2_compatibility");
-	GLAD_GL_ARB_ES3_compatibility = has_ext("GL_ARB_ES3_compatibility");
-	GLAD_GL_ARB_arrays_of_arrays = has_ext("GL_ARB_arrays_of_arrays");
-	GLAD_GL_ARB_base_instance = has_ext("GL_ARB_base_instance");
-	GLAD_GL_ARB_bindless_texture = has_ext("GL_ARB_bindless_texture");
-	GLAD_GL_ARB_blend_func_extended = has_ext("GL_ARB_blend_func_extended");
-	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
-	GLAD_GL_ARB_cl_event = has_ext("GL_ARB_cl_event");
-	GLAD_GL_ARB_clear_buffer_object = has_ext("GL_ARB_clear_buffer_object");
-	GLAD_GL_ARB_clear_texture = has_ext("GL_ARB_clear_texture");
-	GLAD_GL_ARB_clip_control = has_ext("GL_ARB_clip_control");
-	GLAD_GL_ARB_color_buffer_float = has_ext("GL_ARB_color_buffer_float");
-	GLAD_GL_ARB_compatibility = has_ext("GL_ARB_compatibility");
-	GLAD_GL_ARB_compressed_texture_pixel_storage = has_ext("GL_ARB_compressed_texture_pixel_storage");
-	GLAD_GL_ARB_compute_shader = has_ext("GL_ARB_compute_shader");
-	GLAD_GL_ARB_compute_variable_group_size = has_ext("GL_ARB_compute_variable_group_size");
-	GLAD_GL_ARB_conditional_render_inverted = has_ext("GL_ARB_conditional_render_inverted");
-	GLAD_GL_ARB_conservative_depth = has_ext("GL_ARB_conservative_depth");
-	GLAD_GL_ARB_copy_buffer = has_ext("GL_ARB_copy_buffer");
-	GLAD_GL_ARB_copy_image = has_ext("GL_ARB_copy_image");
-	GLAD_GL_ARB_cull_distance = has_ext("GL_ARB_cull_distance");
-	GLAD_GL_ARB_debug_output = has_ext("GL_ARB_debug_output");
-	GLAD_GL_ARB_depth_buffer_float = has_ext("GL_ARB_depth_buffer_float");
-	GLAD_GL_ARB_depth_clamp = has_ext("GL_ARB_depth_clamp");
-	GLAD_GL_ARB_depth_texture = has_ext("GL_ARB_depth_texture");
-	GLAD_GL_ARB_derivative_control = has_ext("GL_ARB_derivative_control");
-	GLAD_GL_ARB_direct_state_access = has_ext("GL_ARB_direct_state_access");
-	GLAD_GL_ARB_draw_buffers = has_ext("GL_ARB_draw_buffers");
-	GLAD_GL_ARB_draw_buffers_blend = has_ext("GL_ARB_draw_buffers_blend");
-	GLAD_GL_ARB_draw_elements_base_vertex = has_ext("GL_ARB_draw_elements_base_vertex");
-	GLAD_GL_ARB_draw_indirect = has_ext("GL_ARB_draw_indirect");
-	GLAD_GL_ARB_draw_instanced = has_ext("GL_ARB_draw_instanced");
-	GLAD_GL_ARB_enhanced_layouts = has_ext("GL_ARB_enhanced_layouts");
-	GLAD_GL_ARB_explicit_attrib_location = has_ext("GL_ARB_explicit_attrib_location");
-	GLAD_GL_ARB_explicit_uniform_location = has_ext("GL_ARB_explicit_uniform_location");
-	GLAD_GL_ARB_fragment_coord_conventions = has_ext("GL_ARB_fragment_coord_conventions");
-	GLAD_GL_ARB_fragment_layer_viewport = has_ext("GL_ARB_fragment_layer_viewport");
-	GLAD_GL_ARB_fragment_program = has_ext("GL_ARB_fragment_program");
-	GLAD_GL_ARB_fragment_program_shadow = has_ext("GL_ARB_fragment_program_shadow");
-	GLAD_GL_ARB_fragment_shader = has_ext("GL_ARB_fragment_shader");
-	GLAD_GL_ARB_fragment_shader_interlock = has_ext("GL_ARB_fragment_shader_interlock");
-	GLAD_GL_ARB_framebuffer_no_attachments = has_ext("GL_ARB_framebuffer_no_attachments");
-	GLAD_GL_ARB_framebuffer_object = has_ext("GL_ARB_framebuffer_object");
-	GLAD_GL_ARB_framebuffer_sRGB = has_ext("GL_ARB_framebuffer_sRGB");
-	GLAD_GL_ARB_geometry_shader4 = has_ext("GL_ARB_geometry_shader4");
-	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
-	GLAD_GL_ARB_get_texture_sub_image = has_ext("GL_ARB_get_texture_sub_image");
-	GLAD_GL_ARB_gpu_shader5 = has_ext("GL_ARB_gpu_shader5");
-	GLAD_GL_ARB_gpu_shader_fp64 = has_ext("GL_ARB_gpu_shader_fp64");
-	GLAD_GL_ARB_gpu_shader_int64 = has_ext("GL_ARB_gpu_shader_int64");
-	GLAD_GL_ARB_half_float_pixel = has_ext("GL_ARB_half_float_pixel");
-	GLAD_GL_ARB_half_float_vertex = has_ext("GL_ARB_half_float_vertex");
-	GLAD_GL_ARB_imaging = has_ext("GL_ARB_imaging");
-	GLAD_GL_ARB_indirect_parameters = has_ext("GL_ARB_indirect_parameters");
-	GLAD_GL_ARB_instanced_arrays = has_ext("GL_ARB_instanced_arrays");
-	GLAD_GL_ARB_internalformat_query = has_ext("GL_ARB_internalformat_query");
-	GLAD_GL_ARB_internalformat_query2 = has_ext("GL_ARB_internalformat_query2");
-	GLAD_GL_ARB_invalidate_subdata = has_ext("GL_ARB_invalidate_subdata");
-	GLAD_GL_ARB_map_buffer_alignment = has_ext("GL_ARB_map_buffer_alignment");
-	GLAD_GL_ARB_map_buffer_range = has_ext("GL_ARB_map_buffer_range");
-	GLAD_GL_ARB_matrix_palette = has_ext("GL_ARB_matrix_palette");
-	GLAD_GL_ARB_multi_bind = has_ext("GL_ARB_multi_bind");
-	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
-	GLAD_GL_ARB_multisample = has_ext("GL_ARB_multisample");
-	GLAD_GL_ARB_multitexture = has_ext("GL_ARB_multitexture");
-	GLAD_GL_ARB_occlusion_query = has_ext("GL_ARB_occlusion_query");
-	GLAD_GL_ARB_occlusion_query2 = has_ext("GL_ARB_occlusion_query2");
-	GLAD_GL_ARB_parallel_shader_compile = has_ext("GL_ARB_parallel_shader_compile");
-	GLAD_GL_ARB_pipeline_statistics_query = has_ext("GL_ARB_pipeline_statistics_query");
-	GLAD_GL_ARB_pixel_buffer_object = has_ext("GL_ARB_pixel_buffer_object");
-	GLAD_GL_ARB_point_parameters = has_ext("GL_ARB_point_parameters");
-	GLAD_GL_ARB_point_sprite = has_ext("GL_ARB_point_sprite");
-	GLAD_GL_ARB_post_depth_coverage = has_ext("GL_ARB_post_depth_coverage");
-	GLAD_GL_ARB_program_interface_query = has_ext("GL_ARB_program_interface_query");
-	GLAD_GL_ARB_provoking_vertex = has_ext("GL_ARB_provoking_vertex");
-	GLAD_GL_ARB_query_buffer_object = has_ext("GL_ARB_query_buffer_object");
-	GLAD_GL_ARB_robust_buffer_access_behavior = has_ext("GL_ARB_robust_buffer_access_behavior");
-	GLAD_GL_ARB_robustness = has_ext("GL_ARB_robustness");
-	GLAD_GL_ARB_robustness_isolation = has_ext("GL_ARB_robustness_isolation");
-	GLAD_GL_ARB_sample_locations = has_ext("GL_ARB_sample_locations");
-	GLAD_GL_ARB_sample_shading = has_ext("GL_ARB_sample_shading");
-	GLAD_GL_ARB_sampler_objects = has_ext("GL_ARB_sampler_objects");
-	GLAD_GL_ARB_seamless_cube_map = has_ext("GL_ARB_seamless_cube_map");
-	GLAD_GL_ARB_seamless_cubemap_per_texture = has_ext("GL_ARB_seamless_cubemap_per_texture");
-	GLAD_GL_ARB_separate_shader_objects = has_ext("GL_ARB_separate_shader_objects");
-	GLAD_GL_ARB_shader_atomic_counter_ops = has_ext("GL_ARB_shader_atomic_counter_ops");
-	GLAD_GL_ARB_shader_atomic_counters = has_ext("GL_ARB_shader_atomic_counters");
-	GLAD_GL_ARB_shader_ballot = has_ext("GL_ARB_shader_ballot");
-	GLAD_GL_ARB_shader_bit_encoding = has_ext("GL_ARB_shader_bit_encoding");
-	GLAD_GL_ARB_shader_clock = has_ext("GL_ARB_shader_clock");
-	GLAD_GL_ARB_shader_draw_parameters = has_ext("GL_ARB_shader_draw_parameters");
-	GLAD_GL_ARB_shader_group_vote = has_ext("GL_ARB_shader_group_vote");
-	GLAD_GL_ARB_shader_image_load_store = has_ext("GL_ARB_shader_image_load_store");
-	GLAD_GL_ARB_shader_image_size = has_ext("GL_ARB_shader_image_size");
-	GLAD_GL_ARB_shader_objects = has_ext("GL_ARB_shader_objects");
-	GLAD_GL_ARB_shader_precision = has_ext("GL_ARB_shader_precision");
-	GLAD_GL_ARB_shader_stencil_export = has_ext("GL_ARB_shader_stencil_export");
-	GLAD_GL_ARB_shader_storage_buffer_object = has_ext("GL_ARB_shader_storage_buffer_object");
-	GLAD_GL_ARB_shader_subroutine = has_ext("GL_ARB_shader_subroutine");
-	GLAD_GL_ARB_shader_texture_image_samples = has_ext("GL_ARB_shader_texture_image_samples");
-	GLAD_GL_ARB_shader_texture_lod = has_ext("GL_ARB_shader_texture_lod");
-	GLAD_GL_ARB_shader_viewport_layer_array = has_ext("GL_ARB_shader_viewport_layer_array");
-	GLAD_GL_ARB_shading_language_100 = has_ext("GL_ARB_shading_language_100");
-	GLAD_GL_ARB_shading_language_420pack = has_ext("GL_ARB_shading_language_420pack");
-	GLAD_GL_ARB_shading_language_include = has_ext("GL_ARB_shading_language_include");
-	GLAD_GL_ARB_shading_language_packing = has_ext("GL_ARB_shading_language_packing");
-	GLAD_GL_ARB_shadow = has_ext("GL_ARB_shadow");
-	GLAD_GL_ARB_shadow_ambient = has_ext("GL_ARB_shadow_ambient");
-	GLAD_GL_ARB_sparse_buffer = has_ext("GL_ARB_sparse_buffer");
-	GLAD_GL_ARB_sparse_texture = has_ext("GL_ARB_sparse_texture");
-	GLAD_GL_ARB_sparse_texture2 = has_ext("GL_ARB_sparse_texture2");
-	GLAD_GL_ARB_sparse_texture_clamp = has_ext("GL_ARB_sparse_texture_clamp");
-	GLAD_GL_ARB_stencil_texturing = has_ext("GL_ARB_stencil_texturing");
-	GLAD_GL_ARB_sync = has_ext("GL_ARB_sync");
-	GLAD_GL_ARB_tessellation_shader = has_ext("GL_ARB_tessellation_shader");
-	GLAD_GL_ARB_texture_barrier = has_ext("GL_ARB_texture_barrier");
-	GLAD_GL_ARB_texture_border_clamp = has_ext("GL_ARB_texture_border_clamp");
-	GLAD_GL_ARB_texture_buffer_object = has_ext("GL_ARB_texture_buffer_object");
-	GLAD_GL_ARB_texture_buffer_object_rgb32 = has_ext("GL_ARB_texture_buffer_object_rgb32");
-	GLAD_GL_ARB_texture_buffer_range = has_ext("GL_ARB_texture_buffer_range");
-	GLAD_GL_ARB_texture_compression = has_ext("GL_ARB_texture_compression");
-	GLAD_GL_ARB_texture_compression_bptc = has_ext("GL_ARB_texture_compression_bptc");
-	GLAD_GL_ARB_texture_compression_rgtc = has_ext("GL_ARB_texture_compression_rgtc");
-	GLAD_GL_ARB_texture_cube_map = has_ext("GL_ARB_texture_cube_map");
-	GLAD_GL_ARB_texture_cube_map_array = has_ext("GL_ARB_texture_cube_map_array");
-	GLAD_GL_ARB_texture_env_add = has_ext("GL_ARB_texture_env_add");
-	GLAD_GL_ARB_texture_env_combine = has_ext("GL_ARB_texture_env_combine");
-	GLAD_GL_ARB_texture_env_crossbar = has_ext("GL_ARB_texture_env_crossbar");
-	GLAD_GL_ARB_texture_env_dot3 = has_ext("GL_ARB_texture_env_dot3");
-	GLAD_GL_ARB_texture_filter_minmax = has_ext("GL_ARB_texture_filter_minmax");
-	GLAD_GL_ARB_texture_float = has_ext("GL_ARB_texture_float");
-	GLAD_GL_ARB_texture_gather = has_ext("GL_ARB_texture_gather");
-	GLAD_GL_ARB_texture_mirror_clamp_to_edge = has_ext("GL_ARB_texture_mirror_clamp_to_edge");
-	GLAD_GL_ARB_texture_mirrored_repeat = has_ext("GL_ARB_texture_mirrored_repeat");
-	GLAD_GL_ARB_texture_multisample = has_ext("GL_ARB_texture_multisample");
-	GLAD_GL_ARB_texture_non_power_of_two = has_ext("GL_ARB_texture_non_power_of_two");
-	GLAD_GL_ARB_texture_query_levels = has_ext("GL_ARB_texture_query_levels");
-	GLAD_GL_ARB_texture_query_lod = has_ext("GL_ARB_texture_query_lod");
-	GLAD_GL_ARB_texture_rectangle = has_ext("GL_ARB_texture_rectangle");
-	GLAD_GL_ARB_texture_rg = has_ext("GL_ARB_texture_rg");
-	GLAD_GL_ARB_texture_rgb10_a2ui = has_ext("GL_ARB_texture_rgb10_a2ui");
-	GLAD_GL_ARB_texture_stencil8 = has_ext("GL_ARB_texture_stencil8");
-	GLAD_GL_ARB_texture_storage = has_ext("GL_ARB_texture_storage");
-	GLAD_GL_ARB_texture_storage_multisample = has_ext("GL_ARB_texture_storage_multisample");
-	GLAD_GL_ARB_texture_swizzle = has_ext("GL_ARB_texture_swizzle");
-	GLAD_GL_ARB_texture_view = has_ext("GL_ARB_texture_view");
-	GLAD_GL_ARB_timer_query = has_ext("GL_ARB_timer_query");
-	GLAD_GL_ARB_transform_feedback2 = has_ext("GL_ARB_transform_feedback2");
-	GLAD_GL_ARB_transform_feedback3 = has_ext("GL_ARB_transform_feedback3");
-	GLAD_GL_ARB_transform_feedback_instanced = has_ext("GL_ARB_transform_feedback_instanced");
-	GLAD_GL_ARB_transform_feedback_overflow_query = has_ext("GL_ARB_transform_feedback_overflow_query");
-	GLAD_GL_ARB_transpose_matrix = has_ext("GL_ARB_transpose_matrix");
-	GLAD_GL_ARB_uniform_buffer_object = has_ext("GL_ARB_uniform_buffer_object");
-	GLAD_GL_ARB_vertex_array_bgra = has_ext("GL_ARB_vertex_array_bgra");
-	GLAD_GL_ARB_vertex_array_object = has_ext("GL_ARB_vertex_array_object");
-	GLAD_GL_ARB_vertex_attrib_64bit = has_ext("GL_ARB_vertex_attrib_64bit");
-	GLAD_GL_ARB_vertex_attrib_binding = has_ext("GL_ARB_vertex_attrib_binding");
-	GLAD_GL_ARB_vertex_blend = has_ext("GL_ARB_vertex_blend");
-	GLAD_GL_ARB_vertex_buffer_object = has_ext("GL_ARB_vertex_buffer_object");
-	GLAD_GL_ARB_vertex_program = has_ext("GL_ARB_vertex_program");
-	GLAD_GL_ARB_vertex_shader = has_ext("GL_ARB_vertex_shader");
-	GLAD_GL_ARB_vertex_type_10f_11f_11f_rev = has_ext("GL_ARB_vertex_type_10f_11f_11f_rev");
-	GLAD_GL_ARB_vertex_type_2_10_10_10_rev = has_ext("GL_ARB_vertex_type_2_10_10_10_rev");
-	GLAD_GL_ARB_viewport_array = has_ext("GL_ARB_viewport_array");
-	GLAD_GL_ARB_window_pos = has_ext("GL_ARB_window_pos");
-	GLAD_GL_ATI_draw_buffers = has_ext("GL_ATI_draw_buffers");
-	GLAD_GL_ATI_element_array = has_ext("GL_ATI_element_array");
-	GLAD_GL_ATI_envmap_bumpmap = has_ext("GL_ATI_envmap_bumpmap");
-	GLAD_GL_ATI_fragment_shader = has_ext("GL_ATI_fragment_shader");
-	GLAD_GL_ATI_map_object_buffer = has_ext("GL_ATI_map_object_buffer");
-	GLAD_GL_ATI_meminfo = has_ext("GL_ATI_meminfo");
-	GLAD_GL_ATI_pixel_format_float = has_ext("GL_ATI_pixel_format_float");
-	GLAD_GL_ATI_pn_triangles = has_ext("GL_ATI_pn_triangles");
-	GLAD_GL_ATI_separate_stencil = has_ext("GL_ATI_separate_stencil");
-	GLAD_GL_ATI_text_fragment_shader = has_ext("GL_ATI_text_fragment_shader");
-	GLAD_GL_ATI_texture_env_combine3 = has_ext("GL_ATI_texture_env_combine3");
-	GLAD_GL_ATI_texture_float = has_ext("GL_ATI_texture_float");
-	GLAD_GL_ATI_texture_mirror_once = has_ext("GL_ATI_texture_mirror_once");
-	GLAD_GL_ATI_vertex_array_object = has_ext("GL_ATI_vertex_array_object");
-	GLAD_GL_ATI_vertex_attrib_array_object = has_ext("GL_ATI_vertex_attrib_array_object");
-	GLAD_GL_ATI_vertex_streams = has_ext("GL_ATI_vertex_streams");
-	GLAD_GL_EXT_422_pixels = has_ext("GL_EXT_422_pixels");
-	GLAD_GL_EXT_abgr = has_ext("GL_EXT_abgr");
-	GLAD_GL_EXT_bgra = has_ext("GL_EXT_bgra");
-	GLAD_GL_EXT_bindable_uniform = has_ext("GL_EXT_bindable_uniform");
-	GLAD_GL_EXT_blend_color = has_ext("GL_EXT_blend_color");
-	GLAD_GL_EXT_blend_equation_separate = has_ext("GL_EXT_blend_equation_separate");
-	GLAD_GL_EXT_blend_func_separate = has_ext("GL_EXT_blend_func_separate");
-	GLAD_GL_EXT_blend_logic_op = has_ext("GL_EXT_blend_logic_op");
-	GLAD_GL_EXT_blend_minmax = has_ext("GL_EXT_blend_minmax");
-	GLAD_GL_EXT_blend_subtract = has_ext("GL_EXT_blend_subtract");
-	GLAD_GL_EXT_clip_volume_hint = has_ext("GL_EXT_clip_volume_hint");
-	GLAD_GL_EXT_cmyka = has_ext("GL_EXT_cmyka");
-	GLAD_GL_EXT_color_subtable = has_ext("GL_EXT_color_subtable");
-	GLAD_GL_EXT_compiled_vertex_array = has_ext("GL_EXT_compiled_vertex_array");
-	GLAD_GL_EXT_convolution = has_ext("GL_EXT_convolution");
-	GLAD_GL_EXT_coordinate_frame = has_ext("GL_EXT_coordinate_frame");
-	GLAD_GL_EXT_copy_texture = has_ext("GL_EXT_copy_texture");
-	GLAD_GL_EXT_cull_vertex = has_ext("GL_EXT_cull_vertex");
-	GLAD_GL_EXT_debug_label = has_ext("GL_EXT_debug_label");
-	GLAD_GL_EXT_debug_marker = has_ext("GL_EXT_debug_marker");
-	GLAD_GL_EXT_depth_bounds_test = has_ext("GL_EXT_depth_bounds_test");
-	GLAD_GL_EXT_direct_state_access = has_ext("GL_EXT_direct_state_access");
-	GLAD_GL_EXT_draw_buffers2 = has_ext("GL_EXT_draw_buffers2");
-	GLAD_GL_EXT_draw_instanced = has_ext("GL_EXT_draw_instanced");
-	GLAD_GL_EXT_draw_range_elements = has_ext("GL_EXT_draw_range_elements");
-	GLAD_GL_EXT_fog_coord = has_ext("GL_EXT_fog_coord");
-	GLAD_GL_EXT_framebuffer_blit = has_ext("GL_EXT_framebuffer_blit");
-	GLAD_GL_EXT_framebuffer_multisample = has_ext("GL_EXT_framebuffer_multisample");
-	GLAD_GL_EXT_framebuffer_multisample_blit_scaled = has_ext("GL_EXT_framebuffer_multisample_blit_scaled");
-	GLAD_GL_EXT_framebuffer_object = has_ext("GL_EXT_framebuffer_object");
-	GLAD_GL_EXT_framebuffer_sRGB = has_ext("GL_EXT_framebuffer_sRGB");
-	GLAD_GL_EXT_geometry_shader4 = has_ext("GL_EXT_geometry_shader4");
-	GLAD_GL_EXT_gpu_program_parameters = has_ext("GL_EXT_gpu_program_parameters");
-	GLAD_GL_EXT_gpu_shader4 = has_ext("GL_EXT_gpu_shader4");
-	GLAD_GL_EXT_histogram = has_ext("GL_EXT_histogram");
-	GLAD_GL_EXT_index_array_formats = has_ext("GL_EXT_index_array_formats");
-	GLAD_GL_EXT_index_func = has_ext("GL_EXT_index_func");
-	GLAD_GL_EXT_index_material = has_ext("GL_EXT_index_material");
-	GLAD_GL_EXT_index_texture = has_ext("GL_EXT_index_texture");
-	GLAD_GL_EXT_light_texture = has_ext("GL_EXT_light_texture");
-	GLAD_GL_EXT_misc_attribute = has_ext("GL_EXT_misc_attribute");
-	GLAD_GL_EXT_multi_draw_arrays = has_ext("GL_EXT_multi_draw_arrays");
-	GLAD_GL_EXT_multisample = has_ext("GL_EXT_multisample");
-	GLAD_GL_EXT_packed_depth_stencil = has_ext("GL_EXT_packed_depth_stencil");
-	GLAD_GL_EXT_packed_float = has_ext("GL_EXT_packed_float");
-	GLAD_GL_EXT_packed_pixels = has_ext("GL_EXT_packed_pixels");
-	GLAD_GL_EXT_paletted_texture = has_ext("GL_EXT_paletted_texture");
-	GLAD_GL_EXT_pixel_buffer_object = has_ext("GL_EXT_pixel_buffer_object");
-	GLAD_GL_EXT_pixel_transform = has_ext("GL_EXT_pixel_transform");
-	GLAD_GL_EXT_pixel_transform_color_table = has_ext("GL_EXT_pixel_transform_color_table");
-	GLAD_GL_EXT_point_parameters = has_ext("GL_EXT_point_parameters");
-	GLAD_GL_EXT_polygon_offset = has_ext("GL_EXT_polygon_offset");
-	GLAD_GL_EXT_polygon_offset_clamp = has_ext("GL_EXT_polygon_offset_clamp");
-	GLAD_GL_EXT_post_depth_coverage = has_ext("GL_EXT_post_depth_coverage");
-	GLAD_GL_EXT_provoking_vertex = has_ext("GL_EXT_provoking_vertex");
-	GLAD_GL_EXT_raster_multisample = has_ext("GL_EXT_raster_multisample");
-	GLAD_GL_EXT_rescale_normal = has_ext("GL_EXT_rescale_normal");
-	GLAD_GL_EXT_secondary_color = has_ext("GL_EXT_secondary_color");
-	GLAD_GL_EXT_separate_shader_objects = has_ext("GL_EXT_separate_shader_objects");
-	GLAD_GL_EXT_separate_specular_color = has_ext("GL_EXT_separate_specular_color");
-	GLAD_GL_EXT_shader_image_load_formatted = has_ext("GL_EXT_shader_image_load_formatted");
-	GLAD_GL_EXT_shader_image_load_store = has_ext("GL_EXT_shader_image_load_store");
-	GLAD_GL_EXT_shader_integer_mix = has_ext("GL_EXT_shader_integer_mix");
-	GLAD_GL_EXT_shadow_funcs = has_ext("GL_EXT_shadow_funcs");
-	GLAD_GL_EXT_shared_texture_palette = has_ext("GL_EXT_shared_texture_palette");
-	GLAD_GL_EXT_sparse_texture2 = has_ext("GL_EXT_sparse_texture2");
-	GLAD_GL_EXT_stencil_clear_tag = has_ext("GL_EXT_stencil_clear_tag");
-	GLAD_GL_EXT_stencil_two_side = has_ext("GL_EXT_stencil_two_side");
-	GLAD_GL_EXT_stencil_wrap = has_ext("GL_EXT_stencil_wrap");
-	GLAD_GL_EXT_subtexture = has_ext("GL_EXT_subtexture");
-	GLAD_GL_EXT_texture = has_ext("GL_EXT_texture");
-	GLAD_GL_EXT_texture3D = has_ext("GL_EXT_texture3D");
-	GLAD_GL_EXT_texture_array = has_ext("GL_EXT_texture_array");
-	GLAD_GL_EXT_texture_buffer_object = has_ext("GL_EXT_texture_buffer_object");
-	GLAD_GL_EXT_texture_compression_latc = has_ext("GL_EXT_texture_compression_latc");
-	GLAD_GL_EXT_texture_compression_rgtc = has_ext("GL_EXT_texture_compression_rgtc");
-	GLAD_GL_EXT_texture_compression_s3tc = has_ext("GL_EXT_texture_compression_s3tc");
-	GLAD_GL_EXT_texture_cube_map = has_ext("GL_EXT_texture_cube_map");
-	GLAD_GL_EXT_texture_env_add = has_ext("GL_EXT_texture_env_add");
-	GLAD_GL_EXT_texture_env_combine = has_ext("GL_EXT_texture_env_combine");
-	GLAD_GL_EXT_texture_env_dot3 = has_ext("GL_EXT_texture_env_dot3");
-	GLAD_GL_EXT_texture_filter_anisotropic = has_ext("GL_EXT_texture_filter_anisotropic");
-	GLAD_GL_EXT_texture_filter_minmax = has_ext("GL_EXT_texture_filter_minmax");
-	GLAD_GL_EXT_texture_integer = has_ext("GL_EXT_texture_integer");
-	GLAD_GL_EXT_texture_lod_bias = has_ext("GL_EXT_texture_lod_bias");
-	GLAD_GL_EXT_texture_mirror_clamp = has_ext("GL_EXT_texture_mirror_clamp");
-	GLAD_GL_EXT_texture_object = has_ext("GL_EXT_texture_object");
-	GLAD_GL_EXT_texture_perturb_normal = has_ext("GL_EXT_texture_perturb_normal");
-	GLAD_GL_EXT_texture_sRGB = has_ext("GL_EXT_texture_sRGB");
-	GLAD_GL_EXT_texture_sRGB_decode = has_ext("GL_EXT_texture_sRGB_decode");
-	GLAD_GL_EXT_texture_shared_exponent = has_ext("GL_EXT_texture_shared_exponent");
-	GLAD_GL_EXT_texture_snorm = has_ext("GL_EXT_texture_snorm");
-	GLAD_GL_EXT_texture_swizzle = has_ext("GL_EXT_texture_swizzle");
-	GLAD_GL_EXT_timer_query = has_ext("GL_EXT_timer_query");
-	GLAD_GL_EXT_transform_feedback = has_ext("GL_EXT_transform_feedback");
-	GLAD_GL_EXT_vertex_array = has_ext("GL_EXT_vertex_array");
-	GLAD_GL_EXT_vertex_array_bgra = has_ext("GL_EXT_vertex_array_bgra");
-	GLAD_GL_EXT_vertex_attrib_64bit = has_ext("GL_EXT_vertex_attrib_64bit");
-	GLAD_GL_EXT_vertex_shader = has_ext("GL_EXT_vertex_shader");
-	GLAD_GL_EXT_vertex_weighting = has_ext("GL_EXT_vertex_weighting");
-	GLAD_GL_EXT_x11_sync_object = has_ext("GL_EXT_x11_sync_object");
-	GLAD_GL_GREMEDY_frame_terminator = has_ext("GL_GREMEDY_frame_terminator");
-	GLAD_GL_GREMEDY_string_marker = has_ext("GL_GREMEDY_string_marker");
-	GLAD_GL_HP_convolution_border_modes = has_ext("GL_HP_convolution_border_modes");
-	GLAD_GL_HP_image_transform = has_ext("GL_HP_image_transform");
-	GLAD_GL_HP_occlusion_test = has_ext("GL_HP_occlusion_test");
-	GLAD_GL_HP_texture_lighting = has_ext("GL_HP_texture_lighting");
-	GLAD_GL_IBM_cull_vertex = has_ext("GL_IBM_cull_vertex");
-	GLAD_GL_IBM_multimode_draw_arrays = has_ext("GL_IBM_multimode_draw_arrays");
-	GLAD_GL_IBM_rasterpos_clip = has_ext("GL_IBM_rasterpos_clip");
-	GLAD_GL_IBM_static_data = has_ext("GL_IBM_static_data");
-	GLAD_GL_IBM_texture_mirrored_repeat = has_ext("GL_IBM_texture_mirrored_repeat");
-	GLAD_GL_IBM_vertex_array_lists = has_ext("GL_IBM_vertex_array_lists");
-	GLAD_GL_INGR_blend_func_separate = has_ext("GL_INGR_blend_func_separate");
-	GLAD_GL_INGR_color_clamp = has_ext("GL_INGR_color_clamp");
-	GLAD_GL_INGR_interlace_read = has_ext("GL_INGR_interlace_read");
-	GLAD_GL_INTEL_fragment_shader_ordering = has_ext("GL_INTEL_fragment_shader_ordering");
-	GLAD_GL_INTEL_framebuffer_CMAA = has_ext("GL_INTEL_framebuffer_CMAA");
-	GLAD_GL_INTEL_map_texture = has_ext("GL_INTEL_map_texture");
-	GLAD_GL_INTEL_parallel_arrays = has_ext("GL_INTEL_parallel_arrays");
-	GLAD_GL_INTEL_performance_query = has_ext("GL_INTEL_performance_query");
-	GLAD_GL_KHR_blend_equation_advanced = has_ext("GL_KHR_blend_equation_advanced");
-	GLAD_GL_KHR_blend_equation_advanced_coherent = has_ext("GL_KHR_blend_equation_advanced_coherent");
-	GLAD_GL_KHR_context_flush_control = has_ext("GL_KHR_context_flush_control");
-	GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
-	GLAD_GL_KHR_no_error = has_ext("GL_KHR_no_error");
-	GLAD_GL_KHR_robust_buffer_access_behavior = has_ext("GL_KHR_robust_buffer_access_behavior");
-	GLAD_GL_KHR_robustness = has_ext("GL_KHR_robustness");
-	GLAD_GL_KHR_texture_compression_astc_hdr = has_ext("GL_KHR_texture_compression_astc_hdr");
-	GLAD_GL_KHR_texture_compression_astc_ldr = has_ext("GL_KHR_texture_compression_astc_ldr");
-	GLAD_GL_KHR_texture_compression_astc_sliced_3d = has_ext("GL_KHR_texture_compression_astc_sliced_3d");
-	GLAD_GL_MESAX_texture_stack = has_ext("GL_MESAX_texture_stack");
-	GLAD_GL_MESA_pack_invert = has_ext("GL_MESA_pack_invert");
-	GLAD_GL_MESA_resize_buffers = has_ext("GL_MESA_resize_buffers");
-	GLAD_GL_MESA_window_pos = has_ext("GL_MESA_window_pos");
-	GLAD_GL_MESA_ycbcr_texture = has_ext("GL_MESA_ycbcr_texture");
-	GLAD_GL_NVX_conditional_render = has_ext("GL_NVX_conditional_render");
-	GLAD_GL_NVX_gpu_memory_info = has_ext("GL_NVX_gpu_memory_info");
-	GLAD_GL_NV_bindless_multi_draw_indirect = has_ext("GL_NV_bindless_multi_draw_indirect");
-	GLAD_GL_NV_bindless_multi_draw_indirect_count = has_ext("GL_NV_bindless_multi_draw_indirect_count");
-	GLAD_GL_NV_bindless_texture = has_ext("GL_NV_bindless_texture");
-	GLAD_GL_NV_blend_equation_advanced = has_ext("GL_NV_blend_equation_advanced");
-	GLAD_GL_NV_blend_equation_advanced_coherent = has_ext("GL_NV_blend_equation_advanced_coherent");
-	GLAD_GL_NV_blend_square = has_ext("GL_NV_blend_square");
-	GLAD_GL_NV_command_list = has_ext("GL_NV_command_list");
-	GLAD_GL_NV_compute_program5 = has_ext("GL_NV_compute_program5");
-	GLAD_GL_NV_conditional_render = has_ext("GL_NV_conditional_render");
-	GLAD_GL_NV_conservative_raster = has_ext("GL_NV_conservative_raster");
-	GLAD_GL_NV_conservative_raster_dilate = has_ext("GL_NV_conservative_raster_dilate");
-	GLAD_GL_NV_copy_depth_to_color = has_ext("GL_NV_copy_depth_to_color");
-	GLAD_GL_NV_copy_image = has_ext("GL_NV_copy_image");
-	GLAD_GL_NV_deep_texture3D = has_ext("GL_NV_deep_texture3D");
-	GLAD_GL_NV_depth_buffer_float = has_ext("GL_NV_depth_buffer_float");
-	GLAD_GL_NV_depth_clamp = has_ext("GL_NV_depth_clamp");
-	GLAD_GL_NV_draw_texture = has_ext("GL_NV_draw_texture");
-	GLAD_GL_NV_evaluators = has_ext("GL_NV_evaluators");
-	GLAD_GL_NV_explicit_multisample = has_ext("GL_NV_explicit_multisample");
-	GLAD_GL_NV_fence = has_ext("GL_NV_fence");
-	GLAD_GL_NV_fill_rectangle = has_ext("GL_NV_fill_rectangle");
-	GLAD_GL_NV_float_buffer = has_ext("GL_NV_float_buffer");
-	GLAD_GL_NV_fog_distance = has_ext("GL_NV_fog_distance");
-	GLAD_GL_NV_fragment_coverage_to_color = has_ext("GL_NV_fragment_coverage_to_color");
-	GLAD_GL_NV_fragment_program = has_ext("GL_NV_fragment_program");
-	GLAD_GL_NV_fragment_program2 = has_ext("GL_NV_fragment_program2");
-	GLAD_GL_NV_fragment_program4 = has_ext("GL_NV_fragment_program4");
-	GLAD_GL_NV_fragment_program_option = has_ext("GL_NV_fragment_program_option");
-	GLAD_GL_NV_fragment_shader_interlock = has_ext("GL_NV_fragment_shader_interlock");
-	GLAD_GL_NV_framebuffer_mixed_samples = has_ext("GL_NV_framebuffer_mixed_samples");
-	GLAD_GL_NV_framebuffer_multisample_coverage = has_ext("GL_NV_framebuffer_multisample_coverage");
-	GLAD_GL_NV_geometry_program4 = has_ext("GL_NV_geometry_program4");
-	GLAD_GL_NV_geometry_shader4 = has_ext("GL_NV_geometry_shader4");
-	GLAD_GL_NV_geometry_shader_passthrough = has_ext("GL_NV_geometry_shader_passthrough");
-	GLAD_GL_NV_gpu_program4 = has_ext("GL_NV_gpu_program4");
-	GLAD_GL_NV_gpu_program5 = has_ext("GL_NV_gpu_program5");
-	GLAD_GL_NV_gpu_program5_mem_extended = has_ext("GL_NV_gpu_program5_mem_extended");
-	GLAD_GL_NV_gpu_shader5 = has_ext("GL_NV_gpu_shader5");
-	GLAD_GL_NV_half_float = has_ext("GL_NV_half_float");
-	GLAD_GL_NV_internalformat_sample_query = has_ext("GL_NV_internalformat_sample_query");
-	GLAD_GL_NV_light_max_exponent = has_ext("GL_NV_light_max_exponent");
-	GLAD_GL_NV_multisample_coverage = has_ext("GL_NV_multisample_coverage");
-	GLAD_GL_NV_multisample_filter_hint = has_ext("GL_NV_multisample_filter_hint");
-	GLAD_GL_NV_occlusion_query = has_ext("GL_NV_occlusion_query");
-	GLAD_GL_NV_packed_depth_stencil = has_ext("GL_NV_packed_depth_stencil");
-	GLAD_GL_NV_parameter_buffer_object = has_ext("GL_NV_parameter_buffer_object");
-	GLAD_GL_NV_parameter_buffer_object2 = has_ext("GL_NV_parameter_buffer_object2");
-	GLAD_GL_NV_path_rendering = has_ext("GL_NV_path_rendering");
-	GLAD_GL_NV_path_rendering_shared_edge = has_ext("GL_NV_path_rendering_shared_edge");
-	GLAD_GL_NV_pixel_data_range = has_ext("GL_NV_pixel_data_range");
-	GLAD_GL_NV_point_sprite = has_ext("GL_NV_point_sprite");
-	GLAD_GL_NV_present_video = has_ext("GL_NV_present_video");
-	GLAD_GL_NV_primitive_restart = has_ext("GL_NV_primitive_restart");
-	GLAD_GL_NV_register_combiners = has_ext("GL_NV_register_combiners");
-	GLAD_GL_NV_register_combiners2 = has_ext("GL_NV_register_combiners2");
-	GLAD_GL_NV_sample_locations = has_ext("GL_NV_sample_locations");
-	GLAD_GL_NV_sample_mask_override_coverage = has_ext("GL_NV_sample_mask_override_coverage");
-	GLAD_GL_NV_shader_atomic_counters = has_ext("GL_NV_shader_atomic_counters");
-	GLAD_GL_NV_shader_atomic_float = has_ext("GL_NV_shader_atomic_float");
-	GLAD_GL_NV_shader_atomic_fp16_vector = has_ext("GL_NV_shader_atomic_fp16_vector");
-	GLAD_GL_NV_shader_atomic_int64 = has_ext("GL_NV_shader_atomic_int64");
-	GLAD_GL_NV_shader_buffer_load = has_ext("GL_NV_shader_buffer_load");
-	GLAD_GL_NV_shader_buffer_store = has_ext("GL_NV_shader_buffer_store");
-	GLAD_GL_NV_shader_storage_buffer_object = has_ext("GL_NV_shader_storage_buffer_object");
-	GLAD_GL_NV_shader_thread_group = has_ext("GL_NV_shader_thread_group");
-	GLAD_GL_NV_shader_thread_shuffle = has_ext("GL_NV_shader_thread_shuffle");
-	GLAD_GL_NV_tessellation_program5 = has_ext("GL_NV_tessellation_program5");
-	GLAD_GL_NV_texgen_emboss = has_ext("GL_NV_texgen_emboss");
-	GLAD_GL_NV_texgen_reflection = has_ext("GL_NV_texgen_reflection");
-	GLAD_GL_NV_texture_barrier = has_ext("GL_NV_texture_barrier");
-	GLAD_GL_NV_texture_compression_vtc = has_ext("GL_NV_texture_compression_vtc");
-	GLAD_GL_NV_texture_env_combine4 = has_ext("GL_NV_texture_env_combine4");
-	GLAD_GL_NV_texture_expand_normal = has_ext("GL_NV_texture_expand_normal");
-	GLAD_GL_NV_texture_multisample = has_ext("GL_NV_texture_multisample");
-	GLAD_GL_NV_texture_rectangle = has_ext("GL_NV_texture_rectangle");
-	GLAD_GL_NV_texture_shader = has_ext("GL_NV_texture_shader");
-	GLAD_GL_NV_texture_shader2 = has_ext("GL_NV_texture_shader2");
-	GLAD_GL_NV_texture_shader3 = has_ext("GL_NV_texture_shader3");
-	GLAD_GL_NV_transform_feedback = has_ext("GL_NV_transform_feedback");
-	GLAD_GL_NV_transform_feedback2 = has_ext("GL_NV_transform_feedback2");
-	GLAD_GL_NV_uniform_buffer_unified_memory = has_ext("GL_NV_uniform_buffer_unified_memory");
-	GLAD_GL_NV_vdpau_interop = has_ext("GL_NV_vdpau_interop");
-	GLAD_GL_NV_vertex_array_range = has_ext("GL_NV_vertex_array_range");
-	GLAD_GL_NV_vertex_array_range2 = has_ext("GL_NV_vertex_array_range2");
-	GLAD_GL_NV_vertex_attrib_integer_64bit = has_ext("GL_NV_vertex_attrib_integer_64bit");
-	GLAD_GL_NV_vertex_buffer_unified_memory = has_ext("GL_NV_vertex_buffer_unified_memory");
-	GLAD_GL_NV_vertex_program = has_ext("GL_NV_vertex_program");
-	GLAD_GL_NV_vertex_program1_1 = has_ext("GL_NV_vertex_program1_1");
-	GLAD_GL_NV_vertex_program2 = has_ext("GL_NV_vertex_program2");
-	GLAD_GL_NV_vertex_program2_option = has_ext("GL_NV_vertex_program2_option");
-	GLAD_GL_NV_vertex_program3 = has_ext("GL_NV_vertex_program3");
-	GLAD_GL_NV_vertex_program4 = has_ext("GL_NV_vertex_program4");
-	GLAD_GL_NV_video_capture = has_ext("GL_NV_video_capture");
-	GLAD_GL_NV_viewport_array2 = has_ext("GL_NV_viewport_array2");
-	GLAD_GL_OES_byte_coordinates = has_ext("GL_OES_byte_coordinates");
-	GLAD_GL_OES_compressed_paletted_texture = has_ext("GL_OES_compressed_paletted_texture");
-	GLAD_GL_OES_fixed_point = has_ext("GL_OES_fixed_point");
-	GLAD_GL_OES_query_matrix = has_ext("GL_OES_query_matrix");
-	GLAD_GL_OES_read_format = has_ext("GL_OES_read_format");
-	GLAD_GL_OES_single_precision = has_ext("GL_OES_single_precision");
-	GLAD_GL_OML_interlace = has_ext("GL_OML_interlace");
-	GLAD_GL_OML_resample = has_ext("GL_OML_resample");
-	GLAD_GL_OML_subsample = has_ext("GL_OML_subsample");
-	GLAD_GL_OVR_multiview = has_ext("GL_OVR_multiview");
-	GLAD_GL_OVR_multiview2 = has_ext("GL_OVR_multiview2");
-	GLAD_GL_PGI_misc_hints = has_ext("GL_PGI_misc_hints");
-	GLAD_GL_PGI_vertex_hints = has_ext("GL_PGI_vertex_hints");
-	GLAD_GL_REND_screen_coordinates = has_ext("GL_REND_screen_coordinates");
-	GLAD_GL_S3_s3tc = has_ext("GL_S3_s3tc");
-	GLAD_GL_SGIS_detail_texture = has_ext("GL_SGIS_detail_texture");
-	GLAD_GL_SGIS_fog_function = has_ext("GL_SGIS_fog_function");
-	GLAD_GL_SGIS_generate_mipmap = has_ext("GL_SGIS_generate_mipmap");
-	GLAD_GL_SGIS_multisample = has_ext("GL_SGIS_multisample");
-	GLAD_GL_SGIS_pixel_texture = has_ext("GL_SGIS_pixel_texture");
-	GLAD_GL_SGIS_point_line_texgen = has_ext("GL_SGIS_point_line_texgen");
-	GLAD_GL_SGIS_point_parameters = has_ext("GL_SGIS_point_parameters");
-	GLAD_GL_SGIS_sharpen_texture = has_ext("GL_SGIS_sharpen_texture");
-	GLAD_GL_SGIS_texture4D = has_ext("GL_SGIS_texture4D");
-	GLAD_GL_SGIS_texture_border_clamp = has_ext("GL_SGIS_texture_border_clamp");
-	GLAD_GL_SGIS_texture_color_mask = has_ext("GL_SGIS_texture_color_mask");
-	GLAD_GL_SGIS_texture_edge_clamp = has_ext("GL_SGIS_texture_edge_clamp");
-	GLAD_GL_SGIS_texture_filter4 = has_ext("GL_SGIS_texture_filter4");
-	GLAD_GL_SGIS_texture_lod = has_ext("GL_SGIS_texture_lod");
-	GLAD_GL_SGIS_texture_select = has_ext("GL_SGIS_texture_select");
-	GLAD_GL_SGIX_async = has_ext("GL_SGIX_async");
-	GLAD_GL_SGIX_async_histogram = has_ext("GL_SGIX_async_histogram");
-	GLAD_GL_SGIX_async_pixel = has_ext("GL_SGIX_async_pixel");
-	GLAD_GL_SGIX_blend_alpha_minmax = has_ext("GL_SGIX_blend_alpha_minmax");
-	GLAD_GL_SGIX_calligraphic_fragment = has_ext("GL_SGIX_calligraphic_fragment");
-	GLAD_GL_SGIX_clipmap = has_ext("GL_SGIX_clipmap");
-	GLAD_GL_SGIX_convolution_accuracy = has_ext("GL_SGIX_convolution_accuracy");
-	GLAD_GL_SGIX_depth_pass_instrument = has_ext("GL_SGIX_depth_pass_instrument");
-	GLAD_GL_SGIX_depth_texture = has_ext("GL_SGIX_depth_texture");
-	GLAD_GL_SGIX_flush_raster = has_ext("GL_SGIX_flush_raster");
-	GLAD_GL_SGIX_fog_offset = has_ext("GL_SGIX_fog_offset");
-	GLAD_GL_SGIX_fragment_lighting = has_ext("GL_SGIX_fragment_lighting");
-	GLAD_GL_SGIX_framezoom = has_ext("GL_SGIX_framezoom");
-	GLAD_GL_SGIX_igloo_interface = has_ext("GL_SGIX_igloo_interface");
-	GLAD_GL_SGIX_instruments = has_ext("GL_SGIX_instruments");
-	GLAD_GL_SGIX_interlace = has_ext("GL_SGIX_interlace");
-	GLAD_GL_SGIX_ir_instrument1 = has_ext("GL_SGIX_ir_instrument1");
-	GLAD_GL_SGIX_list_priority = has_ext("GL_SGIX_list_priority");
-	GLAD_GL_SGIX_pixel_texture = has_ext("GL_SGIX_pixel_texture");
-	GLAD_GL_SGIX_pixel_tiles = has_ext("GL_SGIX_pixel_tiles");
-	GLAD_GL_SGIX_polynomial_ffd = has_ext("GL_SGIX_polynomial_ffd");
-	GLAD_GL_SGIX_reference_plane = has_ext("GL_SGIX_reference_plane");
-	GLAD_GL_SGIX_resample = has_ext("GL_SGIX_resample");
-	GLAD_GL_SGIX_scalebias_hint = has_ext("GL_SGIX_scalebias_hint");
-	GLAD_GL_SGIX_shadow = has_ext("GL_SGIX_shadow");
-	GLAD_GL_SGIX_shadow_ambient = has_ext("GL_SGIX_shadow_ambient");
-	GLAD_GL_SGIX_sprite = has_ext("GL_SGIX_sprite");
-	GLAD_GL_SGIX_subsample = has_ext("GL_SGIX_subsample");
-	GLAD_GL_SGIX_tag_sample_buffer = has_ext("GL_SGIX_tag_sample_buffer");
-	GLAD_GL_SGIX_texture_add_env = has_ext("GL_SGIX_texture_add_env");
-	GLAD_GL_SGIX_texture_coordinate_clamp = has_ext("GL_SGIX_texture_coordinate_clamp");
-	GLAD_GL_SGIX_texture_lod_bias = has_ext("GL_SGIX_texture_lod_bias");
-	GLAD_GL_SGIX_texture_multi_buffer = has_ext("GL_SGIX_texture_multi_buffer");
-	GLAD_GL_SGIX_texture_scale_bias = has_ext("GL_SGIX_texture_scale_bias");
-	GLAD_GL_SGIX_vertex_preclip = has_ext("GL_SGIX_vertex_preclip");
-	GLAD_GL_SGIX_ycrcb = has_ext("GL_SGIX_ycrcb");
-	GLAD_GL_SGIX_ycrcb_subsample = has_ext("GL_SGIX_ycrcb_subsample");
-	GLAD_GL_SGIX_ycrcba = has_ext("GL_SGIX_ycrcba");
-	GLAD_GL_SGI_color_matrix = has_ext("GL_SGI_color_matrix");
-	GLAD_GL_SGI_color_table = has_ext("GL_SGI_color_table");
-	GLAD_GL_SGI_texture_color_table = has_ext("GL_SGI_texture_color_table");
-	GLAD_GL_SUNX_constant_data = has_ext("GL_SUNX_constant_data");
-	GLAD_GL_SUN_convolution_border_modes = has_ext("GL_SUN_convolution_border_modes");
-	GLAD_GL_SUN_global_alpha = has_ext("GL_SUN_global_alpha");
-	GLAD_GL_SUN_mesh_array = has_ext("GL_SUN_mesh_array");
-	GLAD_GL_SUN_slice_accum = has_ext("GL_SUN_slice_accum");
-	GLAD_GL_SUN_triangle_list = has_ext("GL_SUN_triangle_list");
-	GLAD_GL_SUN_vertex = has_ext("GL_SUN_vertex");
-	GLAD_GL_WIN_phong_shading = has_ext("GL_WIN_phong_shading");
-	GLAD_GL_WIN_specular_fog = has_ext("GL_WIN_specular_fog");
-	free_exts();
-	return 1;
+/* One entry per extension, sorted by name: the flag glad sets and the
+ * function that resolves its entry points (NULL when it adds none). */
+struct gladExtensionGL {
+    const char *name;
+    int *flag;
+    void (*loader)(GLADloadproc load);
+};
+
+static const struct gladExtensionGL extensionsGL[] = {
+	{"GL_3DFX_multisample", &GLAD_GL_3DFX_multisample, NULL},
+	{"GL_3DFX_tbuffer", &GLAD_GL_3DFX_tbuffer, load_GL_3DFX_tbuffer},
+	{"GL_3DFX_texture_compression_FXT1", &GLAD_GL_3DFX_texture_compression_FXT1, NULL},
+	{"GL_AMD_blend_minmax_factor", &GLAD_GL_AMD_blend_minmax_factor, NULL},
+	{"GL_AMD_conservative_depth", &GLAD_GL_AMD_conservative_depth, NULL},
+	{"GL_AMD_debug_output", &GLAD_GL_AMD_debug_output, load_GL_AMD_debug_output},
+	{"GL_AMD_depth_clamp_separate", &GLAD_GL_AMD_depth_clamp_separate, NULL},
+	{"GL_AMD_draw_buffers_blend", &GLAD_GL_AMD_draw_buffers_blend, load_GL_AMD_draw_buffers_blend},
+	{"GL_AMD_gcn_shader", &GLAD_GL_AMD_gcn_shader, NULL},
+	{"GL_AMD_gpu_shader_int64", &GLAD_GL_AMD_gpu_shader_int64, load_GL_AMD_gpu_shader_int64},
+	{"GL_AMD_interleaved_elements", &GLAD_GL_AMD_interleaved_elements, load_GL_AMD_interleaved_elements},
+	{"GL_AMD_multi_draw_indirect", &GLAD_GL_AMD_multi_draw_indirect, load_GL_AMD_multi_draw_indirect},
+	{"GL_AMD_name_gen_delete", &GLAD_GL_AMD_name_gen_delete, load_GL_AMD_name_gen_delete},
+	{"GL_AMD_occlusion_query_event", &GLAD_GL_AMD_occlusion_query_event, load_GL_AMD_occlusion_query_event},
+	{"GL_AMD_performance_monitor", &GLAD_GL_AMD_performance_monitor, load_GL_AMD_performance_monitor},
+	{"GL_AMD_pinned_memory", &GLAD_GL_AMD_pinned_memory, NULL},
+	{"GL_AMD_query_buffer_object", &GLAD_GL_AMD_query_buffer_object, NULL},
+	{"GL_AMD_sample_positions", &GLAD_GL_AMD_sample_positions, load_GL_AMD_sample_positions},
+	{"GL_AMD_seamless_cubemap_per_texture", &GLAD_GL_AMD_seamless_cubemap_per_texture, NULL},
+	{"GL_AMD_shader_atomic_counter_ops", &GLAD_GL_AMD_shader_atomic_counter_ops, NULL},
+	{"GL_AMD_shader_stencil_export", &GLAD_GL_AMD_shader_stencil_export, NULL},
+	{"GL_AMD_shader_trinary_minmax", &GLAD_GL_AMD_shader_trinary_minmax, NULL},
+	{"GL_AMD_sparse_texture", &GLAD_GL_AMD_sparse_texture, load_GL_AMD_sparse_texture},
+	{"GL_AMD_stencil_operation_extended", &GLAD_GL_AMD_stencil_operation_extended, load_GL_AMD_stencil_operation_extended},
+	{"GL_AMD_texture_texture4", &GLAD_GL_AMD_texture_texture4, NULL},
+	{"GL_AMD_transform_feedback3_lines_triangles", &GLAD_GL_AMD_transform_feedback3_lines_triangles, NULL},
+	{"GL_AMD_transform_feedback4", &GLAD_GL_AMD_transform_feedback4, NULL},
+	{"GL_AMD_vertex_shader_layer", &GLAD_GL_AMD_vertex_shader_layer, NULL},
+	{"GL_AMD_vertex_shader_tessellator", &GLAD_GL_AMD_vertex_shader_tessellator, load_GL_AMD_vertex_shader_tessellator},
+	{"GL_AMD_vertex_shader_viewport_index", &GLAD_GL_AMD_vertex_shader_viewport_index, NULL},
+	{"GL_APPLE_aux_depth_stencil", &GLAD_GL_APPLE_aux_depth_stencil, NULL},
+	{"GL_APPLE_client_storage", &GLAD_GL_APPLE_client_storage, NULL},
+	{"GL_APPLE_element_array", &GLAD_GL_APPLE_element_array, load_GL_APPLE_element_array},
+	{"GL_APPLE_fence", &GLAD_GL_APPLE_fence, load_GL_APPLE_fence},
+	{"GL_APPLE_float_pixels", &GLAD_GL_APPLE_float_pixels, NULL},
+	{"GL_APPLE_flush_buffer_range", &GLAD_GL_APPLE_flush_buffer_range, load_GL_APPLE_flush_buffer_range},
+	{"GL_APPLE_object_purgeable", &GLAD_GL_APPLE_object_purgeable, load_GL_APPLE_object_purgeable},
+	{"GL_APPLE_rgb_422", &GLAD_GL_APPLE_rgb_422, NULL},
+	{"GL_APPLE_row_bytes", &GLAD_GL_APPLE_row_bytes, NULL},
+	{"GL_APPLE_specular_vector", &GLAD_GL_APPLE_specular_vector, NULL},
+	{"GL_APPLE_texture_range", &GLAD_GL_APPLE_texture_range, load_GL_APPLE_texture_range},
+	{"GL_APPLE_transform_hint", &GLAD_GL_APPLE_transform_hint, NULL},
+	{"GL_APPLE_vertex_array_object", &GLAD_GL_APPLE_vertex_array_object, load_GL_APPLE_vertex_array_object},
+	{"GL_APPLE_vertex_array_range", &GLAD_GL_APPLE_vertex_array_range, load_GL_APPLE_vertex_array_range},
+	{"GL_APPLE_vertex_program_evaluators", &GLAD_GL_APPLE_vertex_program_evaluators, load_GL_APPLE_vertex_program_evaluators},
+	{"GL_APPLE_ycbcr_422", &GLAD_GL_APPLE_ycbcr_422, NULL},
+	{"GL_ARB_ES2_compatibility", &GLAD_GL_ARB_ES2_compatibility, load_GL_ARB_ES2_compatibility},
+	{"GL_ARB_ES3_1_compatibility", &GLAD_GL_ARB_ES3_1_compatibility, load_GL_ARB_ES3_1_compatibility},
+	{"GL_ARB_ES3_2_compatibility", &GLAD_GL_ARB_ES3_2_compatibility, load_GL_ARB_ES3_2_compatibility},
+	{"GL_ARB_ES3_compatibility", &GLAD_GL_ARB_ES3_compatibility, NULL},
+	{"GL_ARB_arrays_of_arrays", &GLAD_GL_ARB_arrays_of_arrays, NULL},
+	{"GL_ARB_base_instance", &GLAD_GL_ARB_base_instance, load_GL_ARB_base_instance},
+	{"GL_ARB_bindless_texture", &GLAD_GL_ARB_bindless_texture, load_GL_ARB_bindless_texture},
+	{"GL_ARB_blend_func_extended", &GLAD_GL_ARB_blend_func_extended, load_GL_ARB_blend_func_extended},
+	{"GL_ARB_buffer_storage", &GLAD_GL_ARB_buffer_storage, load_GL_ARB_buffer_storage},
+	{"GL_ARB_cl_event", &GLAD_GL_ARB_cl_event, load_GL_ARB_cl_event},
+	{"GL_ARB_clear_buffer_object", &GLAD_GL_ARB_clear_buffer_object, load_GL_ARB_clear_buffer_object},
+	{"GL_ARB_clear_texture", &GLAD_GL_ARB_clear_texture, load_GL_ARB_clear_texture},
+	{"GL_ARB_clip_control", &GLAD_GL_ARB_clip_control, load_GL_ARB_clip_control},
+	{"GL_ARB_color_buffer_float", &GLAD_GL_ARB_color_buffer_float, load_GL_ARB_color_buffer_float},
+	{"GL_ARB_compatibility", &GLAD_GL_ARB_compatibility, NULL},
+	{"GL_ARB_compressed_texture_pixel_storage", &GLAD_GL_ARB_compressed_texture_pixel_storage, NULL},
+	{"GL_ARB_compute_shader", &GLAD_GL_ARB_compute_shader, load_GL_ARB_compute_shader},
+	{"GL_ARB_compute_variable_group_size", &GLAD_GL_ARB_compute_variable_group_size, load_GL_ARB_compute_variable_group_size},
+	{"GL_ARB_conditional_render_inverted", &GLAD_GL_ARB_conditional_render_inverted, NULL},
+	{"GL_ARB_conservative_depth", &GLAD_GL_ARB_conservative_depth, NULL},
+	{"GL_ARB_copy_buffer", &GLAD_GL_ARB_copy_buffer, load_GL_ARB_copy_buffer},
+	{"GL_ARB_copy_image", &GLAD_GL_ARB_copy_image, load_GL_ARB_copy_image},
+	{"GL_ARB_cull_distance", &GLAD_GL_ARB_cull_distance, NULL},
+	{"GL_ARB_debug_output", &GLAD_GL_ARB_debug_output, load_GL_ARB_debug_output},
+	{"GL_ARB_depth_buffer_float", &GLAD_GL_ARB_depth_buffer_float, NULL},
+	{"GL_ARB_depth_clamp", &GLAD_GL_ARB_depth_clamp, NULL},
+	{"GL_ARB_depth_texture", &GLAD_GL_ARB_depth_texture, NULL},
+	{"GL_ARB_derivative_control", &GLAD_GL_ARB_derivative_control, NULL},
+	{"GL_ARB_direct_state_access", &GLAD_GL_ARB_direct_state_access, load_GL_ARB_direct_state_access},
+	{"GL_ARB_draw_buffers", &GLAD_GL_ARB_draw_buffers, load_GL_ARB_draw_buffers},
+	{"GL_ARB_draw_buffers_blend", &GLAD_GL_ARB_draw_buffers_blend, load_GL_ARB_draw_buffers_blend},
+	{"GL_ARB_draw_elements_base_vertex", &GLAD_GL_ARB_draw_elements_base_vertex, load_GL_ARB_draw_elements_base_vertex},
+	{"GL_ARB_draw_indirect", &GLAD_GL_ARB_draw_indirect, load_GL_ARB_draw_indirect},
+	{"GL_ARB_draw_instanced", &GLAD_GL_ARB_draw_instanced, load_GL_ARB_draw_instanced},
+	{"GL_ARB_enhanced_layouts", &GLAD_GL_ARB_enhanced_layouts, NULL},
+	{"GL_ARB_explicit_attrib_location", &GLAD_GL_ARB_explicit_attrib_location, NULL},
+	{"GL_ARB_explicit_uniform_location", &GLAD_GL_ARB_explicit_uniform_location, NULL},
+	{"GL_ARB_fragment_coord_conventions", &GLAD_GL_ARB_fragment_coord_conventions, NULL},
+	{"GL_ARB_fragment_layer_viewport", &GLAD_GL_ARB_fragment_layer_viewport, NULL},
+	{"GL_ARB_fragment_program", &GLAD_GL_ARB_fragment_program, load_GL_ARB_fragment_program},
+	{"GL_ARB_fragment_program_shadow", &GLAD_GL_ARB_fragment_program_shadow, NULL},
+	{"GL_ARB_fragment_shader", &GLAD_GL_ARB_fragment_shader, NULL},
+	{"GL_ARB_fragment_shader_interlock", &GLAD_GL_ARB_fragment_shader_interlock, NULL},
+	{"GL_ARB_framebuffer_no_attachments", &GLAD_GL_ARB_framebuffer_no_attachments, load_GL_ARB_framebuffer_no_attachments},
+	{"GL_ARB_framebuffer_object", &GLAD_GL_ARB_framebuffer_object, load_GL_ARB_framebuffer_object},
+	{"GL_ARB_framebuffer_sRGB", &GLAD_GL_ARB_framebuffer_sRGB, NULL},
+	{"GL_ARB_geometry_shader4", &GLAD_GL_ARB_geometry_shader4, load_GL_ARB_geometry_shader4},
+	{"GL_ARB_get_program_binary", &GLAD_GL_ARB_get_program_binary, load_GL_ARB_get_program_binary},
+	{"GL_ARB_get_texture_sub_image", &GLAD_GL_ARB_get_texture_sub_image, load_GL_ARB_get_texture_sub_image},
+	{"GL_ARB_gpu_shader5", &GLAD_GL_ARB_gpu_shader5, NULL},
+	{"GL_ARB_gpu_shader_fp64", &GLAD_GL_ARB_gpu_shader_fp64, load_GL_ARB_gpu_shader_fp64},
+	{"GL_ARB_gpu_shader_int64", &GLAD_GL_ARB_gpu_shader_int64, load_GL_ARB_gpu_shader_int64},
+	{"GL_ARB_half_float_pixel", &GLAD_GL_ARB_half_float_pixel, NULL},
+	{"GL_ARB_half_float_vertex", &GLAD_GL_ARB_half_float_vertex, NULL},
+	{"GL_ARB_imaging", &GLAD_GL_ARB_imaging, load_GL_ARB_imaging},
+	{"GL_ARB_indirect_parameters", &GLAD_GL_ARB_indirect_parameters, load_GL_ARB_indirect_parameters},
+	{"GL_ARB_instanced_arrays", &GLAD_GL_ARB_instanced_arrays, load_GL_ARB_instanced_arrays},
+	{"GL_ARB_internalformat_query", &GLAD_GL_ARB_internalformat_query, load_GL_ARB_internalformat_query},
+	{"GL_ARB_internalformat_query2", &GLAD_GL_ARB_internalformat_query2, load_GL_ARB_internalformat_query2},
+	{"GL_ARB_invalidate_subdata", &GLAD_GL_ARB_invalidate_subdata, load_GL_ARB_invalidate_subdata},
+	{"GL_ARB_map_buffer_alignment", &GLAD_GL_ARB_map_buffer_alignment, NULL},
+	{"GL_ARB_map_buffer_range", &GLAD_GL_ARB_map_buffer_range, load_GL_ARB_map_buffer_range},
+	{"GL_ARB_matrix_palette", &GLAD_GL_ARB_matrix_palette, load_GL_ARB_matrix_palette},
+	{"GL_ARB_multi_bind", &GLAD_GL_ARB_multi_bind, load_GL_ARB_multi_bind},
+	{"GL_ARB_multi_draw_indirect", &GLAD_GL_ARB_multi_draw_indirect, load_GL_ARB_multi_draw_indirect},
+	{"GL_ARB_multisample", &GLAD_GL_ARB_multisample, load_GL_ARB_multisample},
+	{"GL_ARB_multitexture", &GLAD_GL_ARB_multitexture, load_GL_ARB_multitexture},
+	{"GL_ARB_occlusion_query", &GLAD_GL_ARB_occlusion_query, load_GL_ARB_occlusion_query},
+	{"GL_ARB_occlusion_query2", &GLAD_GL_ARB_occlusion_query2, NULL},
+	{"GL_ARB_parallel_shader_compile", &GLAD_GL_ARB_parallel_shader_compile, load_GL_ARB_parallel_shader_compile},
+	{"GL_ARB_pipeline_statistics_query", &GLAD_GL_ARB_pipeline_statistics_query, NULL},
+	{"GL_ARB_pixel_buffer_object", &GLAD_GL_ARB_pixel_buffer_object, NULL},
+	{"GL_ARB_point_parameters", &GLAD_GL_ARB_point_parameters, load_GL_ARB_point_parameters},
+	{"GL_ARB_point_sprite", &GLAD_GL_ARB_point_sprite, NULL},
+	{"GL_ARB_post_depth_coverage", &GLAD_GL_ARB_post_depth_coverage, NULL},
+	{"GL_ARB_program_interface_query", &GLAD_GL_ARB_program_interface_query, load_GL_ARB_program_interface_query},
+	{"GL_ARB_provoking_vertex", &GLAD_GL_ARB_provoking_vertex, load_GL_ARB_provoking_vertex},
+	{"GL_ARB_query_buffer_object", &GLAD_GL_ARB_query_buffer_object, NULL},
+	{"GL_ARB_robust_buffer_access_behavior", &GLAD_GL_ARB_robust_buffer_access_behavior, NULL},
+	{"GL_ARB_robustness", &GLAD_GL_ARB_robustness, load_GL_ARB_robustness},
+	{"GL_ARB_robustness_isolation", &GLAD_GL_ARB_robustness_isolation, NULL},
+	{"GL_ARB_sample_locations", &GLAD_GL_ARB_sample_locations, load_GL_ARB_sample_locations},
+	{"GL_ARB_sample_shading", &GLAD_GL_ARB_sample_shading, load_GL_ARB_sample_shading},
+	{"GL_ARB_sampler_objects", &GLAD_GL_ARB_sampler_objects, load_GL_ARB_sampler_objects},
+	{"GL_ARB_seamless_cube_map", &GLAD_GL_ARB_seamless_cube_map, NULL},
+	{"GL_ARB_seamless_cubemap_per_texture", &GLAD_GL_ARB_seamless_cubemap_per_texture, NULL},
+	{"GL_ARB_separate_shader_objects", &GLAD_GL_ARB_separate_shader_objects, load_GL_ARB_separate_shader_objects},
+	{"GL_ARB_shader_atomic_counter_ops", &GLAD_GL_ARB_shader_atomic_counter_ops, NULL},
+	{"GL_ARB_shader_atomic_counters", &GLAD_GL_ARB_shader_atomic_counters, load_GL_ARB_shader_atomic_counters},
+	{"GL_ARB_shader_ballot", &GLAD_GL_ARB_shader_ballot, NULL},
+	{"GL_ARB_shader_bit_encoding", &GLAD_GL_ARB_shader_bit_encoding, NULL},
+	{"GL_ARB_shader_clock", &GLAD_GL_ARB_shader_clock, NULL},
+	{"GL_ARB_shader_draw_parameters", &GLAD_GL_ARB_shader_draw_parameters, NULL},
+	{"GL_ARB_shader_group_vote", &GLAD_GL_ARB_shader_group_vote, NULL},
+	{"GL_ARB_shader_image_load_store", &GLAD_GL_ARB_shader_image_load_store, load_GL_ARB_shader_image_load_store},
+	{"GL_ARB_shader_image_size", &GLAD_GL_ARB_shader_image_size, NULL},
+	{"GL_ARB_shader_objects", &GLAD_GL_ARB_shader_objects, load_GL_ARB_shader_objects},
+	{"GL_ARB_shader_precision", &GLAD_GL_ARB_shader_precision, NULL},
+	{"GL_ARB_shader_stencil_export", &GLAD_GL_ARB_shader_stencil_export, NULL},
+	{"GL_ARB_shader_storage_buffer_object", &GLAD_GL_ARB_shader_storage_buffer_object, load_GL_ARB_shader_storage_buffer_object},
+	{"GL_ARB_shader_subroutine", &GLAD_GL_ARB_shader_subroutine, load_GL_ARB_shader_subroutine},
+	{"GL_ARB_shader_texture_image_samples", &GLAD_GL_ARB_shader_texture_image_samples, NULL},
+	{"GL_ARB_shader_texture_lod", &GLAD_GL_ARB_shader_texture_lod, NULL},
+	{"GL_ARB_shader_viewport_layer_array", &GLAD_GL_ARB_shader_viewport_layer_array, NULL},
+	{"GL_ARB_shading_language_100", &GLAD_GL_ARB_shading_language_100, NULL},
+	{"GL_ARB_shading_language_420pack", &GLAD_GL_ARB_shading_language_420pack, NULL},
+	{"GL_ARB_shading_language_include", &GLAD_GL_ARB_shading_language_include, load_GL_ARB_shading_language_include},
+	{"GL_ARB_shading_language_packing", &GLAD_GL_ARB_shading_language_packing, NULL},
+	{"GL_ARB_shadow", &GLAD_GL_ARB_shadow, NULL},
+	{"GL_ARB_shadow_ambient", &GLAD_GL_ARB_shadow_ambient, NULL},
+	{"GL_ARB_sparse_buffer", &GLAD_GL_ARB_sparse_buffer, load_GL_ARB_sparse_buffer},
+	{"GL_ARB_sparse_texture", &GLAD_GL_ARB_sparse_texture, load_GL_ARB_sparse_texture},
+	{"GL_ARB_sparse_texture2", &GLAD_GL_ARB_sparse_texture2, NULL},
+	{"GL_ARB_sparse_texture_clamp", &GLAD_GL_ARB_sparse_texture_clamp, NULL},
+	{"GL_ARB_stencil_texturing", &GLAD_GL_ARB_stencil_texturing, NULL},
+	{"GL_ARB_sync", &GLAD_GL_ARB_sync, load_GL_ARB_sync},
+	{"GL_ARB_tessellation_shader", &GLAD_GL_ARB_tessellation_shader, load_GL_ARB_tessellation_shader},
+	{"GL_ARB_texture_barrier", &GLAD_GL_ARB_texture_barrier, load_GL_ARB_texture_barrier},
+	{"GL_ARB_texture_border_clamp", &GLAD_GL_ARB_texture_border_clamp, NULL},
+	{"GL_ARB_texture_buffer_object", &GLAD_GL_ARB_texture_buffer_object, load_GL_ARB_texture_buffer_object},
+	{"GL_ARB_texture_buffer_object_rgb32", &GLAD_GL_ARB_texture_buffer_object_rgb32, NULL},
+	{"GL_ARB_texture_buffer_range", &GLAD_GL_ARB_texture_buffer_range, load_GL_ARB_texture_buffer_range},
+	{"GL_ARB_texture_compression", &GLAD_GL_ARB_texture_compression, load_GL_ARB_texture_compression},
+	{"GL_ARB_texture_compression_bptc", &GLAD_GL_ARB_texture_compression_bptc, NULL},
+	{"GL_ARB_texture_compression_rgtc", &GLAD_GL_ARB_texture_compression_rgtc, NULL},
+	{"GL_ARB_texture_cube_map", &GLAD_GL_ARB_texture_cube_map, NULL},
+	{"GL_ARB_texture_cube_map_array", &GLAD_GL_ARB_texture_cube_map_array, NULL},
+	{"GL_ARB_texture_env_add", &GLAD_GL_ARB_texture_env_add, NULL},
+	{"GL_ARB_texture_env_combine", &GLAD_GL_ARB_texture_env_combine, NULL},
+	{"GL_ARB_texture_env_crossbar", &GLAD_GL_ARB_texture_env_crossbar, NULL},
+	{"GL_ARB_texture_env_dot3", &GLAD_GL_ARB_texture_env_dot3, NULL},
+	{"GL_ARB_texture_filter_minmax", &GLAD_GL_ARB_texture_filter_minmax, NULL},
+	{"GL_ARB_texture_float", &GLAD_GL_ARB_texture_float, NULL},
+	{"GL_ARB_texture_gather", &GLAD_GL_ARB_texture_gather, NULL},
+	{"GL_ARB_texture_mirror_clamp_to_edge", &GLAD_GL_ARB_texture_mirror_clamp_to_edge, NULL},
+	{"GL_ARB_texture_mirrored_repeat", &GLAD_GL_ARB_texture_mirrored_repeat, NULL},
+	{"GL_ARB_texture_multisample", &GLAD_GL_ARB_texture_multisample, load_GL_ARB_texture_multisample},
+	{"GL_ARB_texture_non_power_of_two", &GLAD_GL_ARB_texture_non_power_of_two, NULL},
+	{"GL_ARB_texture_query_levels", &GLAD_GL_ARB_texture_query_levels, NULL},
+	{"GL_ARB_texture_query_lod", &GLAD_GL_ARB_texture_query_lod, NULL},
+	{"GL_ARB_texture_rectangle", &GLAD_GL_ARB_texture_rectangle, NULL},
+	{"GL_ARB_texture_rg", &GLAD_GL_ARB_texture_rg, NULL},
+	{"GL_ARB_texture_rgb10_a2ui", &GLAD_GL_ARB_texture_rgb10_a2ui, NULL},
+	{"GL_ARB_texture_stencil8", &GLAD_GL_ARB_texture_stencil8, NULL},
+	{"GL_ARB_texture_storage", &GLAD_GL_ARB_texture_storage, load_GL_ARB_texture_storage},
+	{"GL_ARB_texture_storage_multisample", &GLAD_GL_ARB_texture_storage_multisample, load_GL_ARB_texture_storage_multisample},
+	{"GL_ARB_texture_swizzle", &GLAD_GL_ARB_texture_swizzle, NULL},
+	{"GL_ARB_texture_view", &GLAD_GL_ARB_texture_view, load_GL_ARB_texture_view},
+	{"GL_ARB_timer_query", &GLAD_GL_ARB_timer_query, load_GL_ARB_timer_query},
+	{"GL_ARB_transform_feedback2", &GLAD_GL_ARB_transform_feedback2, load_GL_ARB_transform_feedback2},
+	{"GL_ARB_transform_feedback3", &GLAD_GL_ARB_transform_feedback3, load_GL_ARB_transform_feedback3},
+	{"GL_ARB_transform_feedback_instanced", &GLAD_GL_ARB_transform_feedback_instanced, load_GL_ARB_transform_feedback_instanced},
+	{"GL_ARB_transform_feedback_overflow_query", &GLAD_GL_ARB_transform_feedback_overflow_query, NULL},
+	{"GL_ARB_transpose_matrix", &GLAD_GL_ARB_transpose_matrix, load_GL_ARB_transpose_matrix},
+	{"GL_ARB_uniform_buffer_object", &GLAD_GL_ARB_uniform_buffer_object, load_GL_ARB_uniform_buffer_object},
+	{"GL_ARB_vertex_array_bgra", &GLAD_GL_ARB_vertex_array_bgra, NULL},
+	{"GL_ARB_vertex_array_object", &GLAD_GL_ARB_vertex_array_object, load_GL_ARB_vertex_array_object},
+	{"GL_ARB_vertex_attrib_64bit", &GLAD_GL_ARB_vertex_attrib_64bit, load_GL_ARB_vertex_attrib_64bit},
+	{"GL_ARB_vertex_attrib_binding", &GLAD_GL_ARB_vertex_attrib_binding, load_GL_ARB_vertex_attrib_binding},
+	{"GL_ARB_vertex_blend", &GLAD_GL_ARB_vertex_blend, load_GL_ARB_vertex_blend},
+	{"GL_ARB_vertex_buffer_object", &GLAD_GL_ARB_vertex_buffer_object, load_GL_ARB_vertex_buffer_object},
+	{"GL_ARB_vertex_program", &GLAD_GL_ARB_vertex_program, load_GL_ARB_vertex_program},
+	{"GL_ARB_vertex_shader", &GLAD_GL_ARB_vertex_shader, load_GL_ARB_vertex_shader},
+	{"GL_ARB_vertex_type_10f_11f_11f_rev", &GLAD_GL_ARB_vertex_type_10f_11f_11f_rev, NULL},
+	{"GL_ARB_vertex_type_2_10_10_10_rev", &GLAD_GL_ARB_vertex_type_2_10_10_10_rev, load_GL_ARB_vertex_type_2_10_10_10_rev},
+	{"GL_ARB_viewport_array", &GLAD_GL_ARB_viewport_array, load_GL_ARB_viewport_array},
+	{"GL_ARB_window_pos", &GLAD_GL_ARB_window_pos, load_GL_ARB_window_pos},
+	{"GL_ATI_draw_buffers", &GLAD_GL_ATI_draw_buffers, load_GL_ATI_draw_buffers},
+	{"GL_ATI_element_array", &GLAD_GL_ATI_element_array, load_GL_ATI_element_array},
+	{"GL_ATI_envmap_bumpmap", &GLAD_GL_ATI_envmap_bumpmap, load_GL_ATI_envmap_bumpmap},
+	{"GL_ATI_fragment_shader", &GLAD_GL_ATI_fragment_shader, load_GL_ATI_fragment_shader},
+	{"GL_ATI_map_object_buffer", &GLAD_GL_ATI_map_object_buffer, load_GL_ATI_map_object_buffer},
+	{"GL_ATI_meminfo", &GLAD_GL_ATI_meminfo, NULL},
+	{"GL_ATI_pixel_format_float", &GLAD_GL_ATI_pixel_format_float, NULL},
+	{"GL_ATI_pn_triangles", &GLAD_GL_ATI_pn_triangles, load_GL_ATI_pn_triangles},
+	{"GL_ATI_separate_stencil", &GLAD_GL_ATI_separate_stencil, load_GL_ATI_separate_stencil},
+	{"GL_ATI_text_fragment_shader", &GLAD_GL_ATI_text_fragment_shader, NULL},
+	{"GL_ATI_texture_env_combine3", &GLAD_GL_ATI_texture_env_combine3, NULL},
+	{"GL_ATI_texture_float", &GLAD_GL_ATI_texture_float, NULL},
+	{"GL_ATI_texture_mirror_once", &GLAD_GL_ATI_texture_mirror_once, NULL},
+	{"GL_ATI_vertex_array_object", &GLAD_GL_ATI_vertex_array_object, load_GL_ATI_vertex_array_object},
+	{"GL_ATI_vertex_attrib_array_object", &GLAD_GL_ATI_vertex_attrib_array_object, load_GL_ATI_vertex_attrib_array_object},
+	{"GL_ATI_vertex_streams", &GLAD_GL_ATI_vertex_streams, load_GL_ATI_vertex_streams},
+	{"GL_EXT_422_pixels", &GLAD_GL_EXT_422_pixels, NULL},
+	{"GL_EXT_abgr", &GLAD_GL_EXT_abgr, NULL},
+	{"GL_EXT_bgra", &GLAD_GL_EXT_bgra, NULL},
+	{"GL_EXT_bindable_uniform", &GLAD_GL_EXT_bindable_uniform, load_GL_EXT_bindable_uniform},
+	{"GL_EXT_blend_color", &GLAD_GL_EXT_blend_color, load_GL_EXT_blend_color},
+	{"GL_EXT_blend_equation_separate", &GLAD_GL_EXT_blend_equation_separate, load_GL_EXT_blend_equation_separate},
+	{"GL_EXT_blend_func_separate", &GLAD_GL_EXT_blend_func_separate, load_GL_EXT_blend_func_separate},
+	{"GL_EXT_blend_logic_op", &GLAD_GL_EXT_blend_logic_op, NULL},
+	{"GL_EXT_blend_minmax", &GLAD_GL_EXT_blend_minmax, load_GL_EXT_blend_minmax},
+	{"GL_EXT_blend_subtract", &GLAD_GL_EXT_blend_subtract, NULL},
+	{"GL_EXT_clip_volume_hint", &GLAD_GL_EXT_clip_volume_hint, NULL},
+	{"GL_EXT_cmyka", &GLAD_GL_EXT_cmyka, NULL},
+	{"GL_EXT_color_subtable", &GLAD_GL_EXT_color_subtable, load_GL_EXT_color_subtable},
+	{"GL_EXT_compiled_vertex_array", &GLAD_GL_EXT_compiled_vertex_array, load_GL_EXT_compiled_vertex_array},
+	{"GL_EXT_convolution", &GLAD_GL_EXT_convolution, load_GL_EXT_convolution},
+	{"GL_EXT_coordinate_frame", &GLAD_GL_EXT_coordinate_frame, load_GL_EXT_coordinate_frame},
+	{"GL_EXT_copy_texture", &GLAD_GL_EXT_copy_texture, load_GL_EXT_copy_texture},
+	{"GL_EXT_cull_vertex", &GLAD_GL_EXT_cull_vertex, load_GL_EXT_cull_vertex},
+	{"GL_EXT_debug_label", &GLAD_GL_EXT_debug_label, load_GL_EXT_debug_label},
+	{"GL_EXT_debug_marker", &GLAD_GL_EXT_debug_marker, load_GL_EXT_debug_marker},
+	{"GL_EXT_depth_bounds_test", &GLAD_GL_EXT_depth_bounds_test, load_GL_EXT_depth_bounds_test},
+	{"GL_EXT_direct_state_access", &GLAD_GL_EXT_direct_state_access, load_GL_EXT_direct_state_access},
+	{"GL_EXT_draw_buffers2", &GLAD_GL_EXT_draw_buffers2, load_GL_EXT_draw_buffers2},
+	{"GL_EXT_draw_instanced", &GLAD_GL_EXT_draw_instanced, load_GL_EXT_draw_instanced},
+	{"GL_EXT_draw_range_elements", &GLAD_GL_EXT_draw_range_elements, load_GL_EXT_draw_range_elements},
+	{"GL_EXT_fog_coord", &GLAD_GL_EXT_fog_coord, load_GL_EXT_fog_coord},
+	{"GL_EXT_framebuffer_blit", &GLAD_GL_EXT_framebuffer_blit, load_GL_EXT_framebuffer_blit},
+	{"GL_EXT_framebuffer_multisample", &GLAD_GL_EXT_framebuffer_multisample, load_GL_EXT_framebuffer_multisample},
+	{"GL_EXT_framebuffer_multisample_blit_scaled", &GLAD_GL_EXT_framebuffer_multisample_blit_scaled, NULL},
+	{"GL_EXT_framebuffer_object", &GLAD_GL_EXT_framebuffer_object, load_GL_EXT_framebuffer_object},
+	{"GL_EXT_framebuffer_sRGB", &GLAD_GL_EXT_framebuffer_sRGB, NULL},
+	{"GL_EXT_geometry_shader4", &GLAD_GL_EXT_geometry_shader4, load_GL_EXT_geometry_shader4},
+	{"GL_EXT_gpu_program_parameters", &GLAD_GL_EXT_gpu_program_parameters, load_GL_EXT_gpu_program_parameters},
+	{"GL_EXT_gpu_shader4", &GLAD_GL_EXT_gpu_shader4, load_GL_EXT_gpu_shader4},
+	{"GL_EXT_histogram", &GLAD_GL_EXT_histogram, load_GL_EXT_histogram},
+	{"GL_EXT_index_array_formats", &GLAD_GL_EXT_index_array_formats, NULL},
+	{"GL_EXT_index_func", &GLAD_GL_EXT_index_func, load_GL_EXT_index_func},
+	{"GL_EXT_index_material", &GLAD_GL_EXT_index_material, load_GL_EXT_index_material},
+	{"GL_EXT_index_texture", &GLAD_GL_EXT_index_texture, NULL},
+	{"GL_EXT_light_texture", &GLAD_GL_EXT_light_texture, load_GL_EXT_light_texture},
+	{"GL_EXT_misc_attribute", &GLAD_GL_EXT_misc_attribute, NULL},
+	{"GL_EXT_multi_draw_arrays", &GLAD_GL_EXT_multi_draw_arrays, load_GL_EXT_multi_draw_arrays},
+	{"GL_EXT_multisample", &GLAD_GL_EXT_multisample, load_GL_EXT_multisample},
+	{"GL_EXT_packed_depth_stencil", &GLAD_GL_EXT_packed_depth_stencil, NULL},
+	{"GL_EXT_packed_float", &GLAD_GL_EXT_packed_float, NULL},
+	{"GL_EXT_packed_pixels", &GLAD_GL_EXT_packed_pixels, NULL},
+	{"GL_EXT_paletted_texture", &GLAD_GL_EXT_paletted_texture, load_GL_EXT_paletted_texture},
+	{"GL_EXT_pixel_buffer_object", &GLAD_GL_EXT_pixel_buffer_object, NULL},
+	{"GL_EXT_pixel_transform", &GLAD_GL_EXT_pixel_transform, load_GL_EXT_pixel_transform},
+	{"GL_EXT_pixel_transform_color_table", &GLAD_GL_EXT_pixel_transform_color_table, NULL},
+	{"GL_EXT_point_parameters", &GLAD_GL_EXT_point_parameters, load_GL_EXT_point_parameters},
+	{"GL_EXT_polygon_offset", &GLAD_GL_EXT_polygon_offset, load_GL_EXT_polygon_offset},
+	{"GL_EXT_polygon_offset_clamp", &GLAD_GL_EXT_polygon_offset_clamp, load_GL_EXT_polygon_offset_clamp},
+	{"GL_EXT_post_depth_coverage", &GLAD_GL_EXT_post_depth_coverage, NULL},
+	{"GL_EXT_provoking_vertex", &GLAD_GL_EXT_provoking_vertex, load_GL_EXT_provoking_vertex},
+	{"GL_EXT_raster_multisample", &GLAD_GL_EXT_raster_multisample, load_GL_EXT_raster_multisample},
+	{"GL_EXT_rescale_normal", &GLAD_GL_EXT_rescale_normal, NULL},
+	{"GL_EXT_secondary_color", &GLAD_GL_EXT_secondary_color, load_GL_EXT_secondary_color},
+	{"GL_EXT_separate_shader_objects", &GLAD_GL_EXT_separate_shader_objects, load_GL_EXT_separate_shader_objects},
+	{"GL_EXT_separate_specular_color", &GLAD_GL_EXT_separate_specular_color, NULL},
+	{"GL_EXT_shader_image_load_formatted", &GLAD_GL_EXT_shader_image_load_formatted, NULL},
+	{"GL_EXT_shader_image_load_store", &GLAD_GL_EXT_shader_image_load_store, load_GL_EXT_shader_image_load_store},
+	{"GL_EXT_shader_integer_mix", &GLAD_GL_EXT_shader_integer_mix, NULL},
+	{"GL_EXT_shadow_funcs", &GLAD_GL_EXT_shadow_funcs, NULL},
+	{"GL_EXT_shared_texture_palette", &GLAD_GL_EXT_shared_texture_palette, NULL},
+	{"GL_EXT_sparse_texture2", &GLAD_GL_EXT_sparse_texture2, NULL},
+	{"GL_EXT_stencil_clear_tag", &GLAD_GL_EXT_stencil_clear_tag, load_GL_EXT_stencil_clear_tag},
+	{"GL_EXT_stencil_two_side", &GLAD_GL_EXT_stencil_two_side, load_GL_EXT_stencil_two_side},
+	{"GL_EXT_stencil_wrap", &GLAD_GL_EXT_stencil_wrap, NULL},
+	{"GL_EXT_subtexture", &GLAD_GL_EXT_subtexture, load_GL_EXT_subtexture},
+	{"GL_EXT_texture", &GLAD_GL_EXT_texture, NULL},
+	{"GL_EXT_texture3D", &GLAD_GL_EXT_texture3D, load_GL_EXT_texture3D},
+	{"GL_EXT_texture_array", &GLAD_GL_EXT_texture_array, load_GL_EXT_texture_array},
+	{"GL_EXT_texture_buffer_object", &GLAD_GL_EXT_texture_buffer_object, load_GL_EXT_texture_buffer_object},
+	{"GL_EXT_texture_compression_latc", &GLAD_GL_EXT_texture_compression_latc, NULL},
+	{"GL_EXT_texture_compression_rgtc", &GLAD_GL_EXT_texture_compression_rgtc, NULL},
+	{"GL_EXT_texture_compression_s3tc", &GLAD_GL_EXT_texture_compression_s3tc, NULL},
+	{"GL_EXT_texture_cube_map", &GLAD_GL_EXT_texture_cube_map, NULL},
+	{"GL_EXT_texture_env_add", &GLAD_GL_EXT_texture_env_add, NULL},
+	{"GL_EXT_texture_env_combine", &GLAD_GL_EXT_texture_env_combine, NULL},
+	{"GL_EXT_texture_env_dot3", &GLAD_GL_EXT_texture_env_dot3, NULL},
+	{"GL_EXT_texture_filter_anisotropic", &GLAD_GL_EXT_texture_filter_anisotropic, NULL},
+	{"GL_EXT_texture_filter_minmax", &GLAD_GL_EXT_texture_filter_minmax, load_GL_EXT_texture_filter_minmax},
+	{"GL_EXT_texture_integer", &GLAD_GL_EXT_texture_integer, load_GL_EXT_texture_integer},
+	{"GL_EXT_texture_lod_bias", &GLAD_GL_EXT_texture_lod_bias, NULL},
+	{"GL_EXT_texture_mirror_clamp", &GLAD_GL_EXT_texture_mirror_clamp, NULL},
+	{"GL_EXT_texture_object", &GLAD_GL_EXT_texture_object, load_GL_EXT_texture_object},
+	{"GL_EXT_texture_perturb_normal", &GLAD_GL_EXT_texture_perturb_normal, load_GL_EXT_texture_perturb_normal},
+	{"GL_EXT_texture_sRGB", &GLAD_GL_EXT_texture_sRGB, NULL},
+	{"GL_EXT_texture_sRGB_decode", &GLAD_GL_EXT_texture_sRGB_decode, NULL},
+	{"GL_EXT_texture_shared_exponent", &GLAD_GL_EXT_texture_shared_exponent, NULL},
+	{"GL_EXT_texture_snorm", &GLAD_GL_EXT_texture_snorm, NULL},
+	{"GL_EXT_texture_swizzle", &GLAD_GL_EXT_texture_swizzle, NULL},
+	{"GL_EXT_timer_query", &GLAD_GL_EXT_timer_query, load_GL_EXT_timer_query},
+	{"GL_EXT_transform_feedback", &GLAD_GL_EXT_transform_feedback, load_GL_EXT_transform_feedback},
+	{"GL_EXT_vertex_array", &GLAD_GL_EXT_vertex_array, load_GL_EXT_vertex_array},
+	{"GL_EXT_vertex_array_bgra", &GLAD_GL_EXT_vertex_array_bgra, NULL},
+	{"GL_EXT_vertex_attrib_64bit", &GLAD_GL_EXT_vertex_attrib_64bit, load_GL_EXT_vertex_attrib_64bit},
+	{"GL_EXT_vertex_shader", &GLAD_GL_EXT_vertex_shader, load_GL_EXT_vertex_shader},
+	{"GL_EXT_vertex_weighting", &GLAD_GL_EXT_vertex_weighting, load_GL_EXT_vertex_weighting},
+	{"GL_EXT_x11_sync_object", &GLAD_GL_EXT_x11_sync_object, load_GL_EXT_x11_sync_object},
+	{"GL_GREMEDY_frame_terminator", &GLAD_GL_GREMEDY_frame_terminator, load_GL_GREMEDY_frame_terminator},
+	{"GL_GREMEDY_string_marker", &GLAD_GL_GREMEDY_string_marker, load_GL_GREMEDY_string_marker},
+	{"GL_HP_convolution_border_modes", &GLAD_GL_HP_convolution_border_modes, NULL},
+	{"GL_HP_image_transform", &GLAD_GL_HP_image_transform, load_GL_HP_image_transform},
+	{"GL_HP_occlusion_test", &GLAD_GL_HP_occlusion_test, NULL},
+	{"GL_HP_texture_lighting", &GLAD_GL_HP_texture_lighting, NULL},
+	{"GL_IBM_cull_vertex", &GLAD_GL_IBM_cull_vertex, NULL},
+	{"GL_IBM_multimode_draw_arrays", &GLAD_GL_IBM_multimode_draw_arrays, load_GL_IBM_multimode_draw_arrays},
+	{"GL_IBM_rasterpos_clip", &GLAD_GL_IBM_rasterpos_clip, NULL},
+	{"GL_IBM_static_data", &GLAD_GL_IBM_static_data, load_GL_IBM_static_data},
+	{"GL_IBM_texture_mirrored_repeat", &GLAD_GL_IBM_texture_mirrored_repeat, NULL},
+	{"GL_IBM_vertex_array_lists", &GLAD_GL_IBM_vertex_array_lists, load_GL_IBM_vertex_array_lists},
+	{"GL_INGR_blend_func_separate", &GLAD_GL_INGR_blend_func_separate, load_GL_INGR_blend_func_separate},
+	{"GL_INGR_color_clamp", &GLAD_GL_INGR_color_clamp, NULL},
+	{"GL_INGR_interlace_read", &GLAD_GL_INGR_interlace_read, NULL},
+	{"GL_INTEL_fragment_shader_ordering", &GLAD_GL_INTEL_fragment_shader_ordering, NULL},
+	{"GL_INTEL_framebuffer_CMAA", &GLAD_GL_INTEL_framebuffer_CMAA, load_GL_INTEL_framebuffer_CMAA},
+	{"GL_INTEL_map_texture", &GLAD_GL_INTEL_map_texture, load_GL_INTEL_map_texture},
+	{"GL_INTEL_parallel_arrays", &GLAD_GL_INTEL_parallel_arrays, load_GL_INTEL_parallel_arrays},
+	{"GL_INTEL_performance_query", &GLAD_GL_INTEL_performance_query, load_GL_INTEL_performance_query},
+	{"GL_KHR_blend_equation_advanced", &GLAD_GL_KHR_blend_equation_advanced, load_GL_KHR_blend_equation_advanced},
+	{"GL_KHR_blend_equation_advanced_coherent", &GLAD_GL_KHR_blend_equation_advanced_coherent, NULL},
+	{"GL_KHR_context_flush_control", &GLAD_GL_KHR_context_flush_control, NULL},
+	{"GL_KHR_debug", &GLAD_GL_KHR_debug, load_GL_KHR_debug},
+	{"GL_KHR_no_error", &GLAD_GL_KHR_no_error, NULL},
+	{"GL_KHR_robust_buffer_access_behavior", &GLAD_GL_KHR_robust_buffer_access_behavior, NULL},
+	{"GL_KHR_robustness", &GLAD_GL_KHR_robustness, load_GL_KHR_robustness},
+	{"GL_KHR_texture_compression_astc_hdr", &GLAD_GL_KHR_texture_compression_astc_hdr, NULL},
+	{"GL_KHR_texture_compression_astc_ldr", &GLAD_GL_KHR_texture_compression_astc_ldr, NULL},
+	{"GL_KHR_texture_compression_astc_sliced_3d", &GLAD_GL_KHR_texture_compression_astc_sliced_3d, NULL},
+	{"GL_MESAX_texture_stack", &GLAD_GL_MESAX_texture_stack, NULL},
+	{"GL_MESA_pack_invert", &GLAD_GL_MESA_pack_invert, NULL},
+	{"GL_MESA_resize_buffers", &GLAD_GL_MESA_resize_buffers, load_GL_MESA_resize_buffers},
+	{"GL_MESA_window_pos", &GLAD_GL_MESA_window_pos, load_GL_MESA_window_pos},
+	{"GL_MESA_ycbcr_texture", &GLAD_GL_MESA_ycbcr_texture, NULL},
+	{"GL_NVX_conditional_render", &GLAD_GL_NVX_conditional_render, load_GL_NVX_conditional_render},
+	{"GL_NVX_gpu_memory_info", &GLAD_GL_NVX_gpu_memory_info, NULL},
+	{"GL_NV_bindless_multi_draw_indirect", &GLAD_GL_NV_bindless_multi_draw_indirect, load_GL_NV_bindless_multi_draw_indirect},
+	{"GL_NV_bindless_multi_draw_indirect_count", &GLAD_GL_NV_bindless_multi_draw_indirect_count, load_GL_NV_bindless_multi_draw_indirect_count},
+	{"GL_NV_bindless_texture", &GLAD_GL_NV_bindless_texture, load_GL_NV_bindless_texture},
+	{"GL_NV_blend_equation_advanced", &GLAD_GL_NV_blend_equation_advanced, load_GL_NV_blend_equation_advanced},
+	{"GL_NV_blend_equation_advanced_coherent", &GLAD_GL_NV_blend_equation_advanced_coherent, NULL},
+	{"GL_NV_blend_square", &GLAD_GL_NV_blend_square, NULL},
+	{"GL_NV_command_list", &GLAD_GL_NV_command_list, load_GL_NV_command_list},
+	{"GL_NV_compute_program5", &GLAD_GL_NV_compute_program5, NULL},
+	{"GL_NV_conditional_render", &GLAD_GL_NV_conditional_render, load_GL_NV_conditional_render},
+	{"GL_NV_conservative_raster", &GLAD_GL_NV_conservative_raster, load_GL_NV_conservative_raster},
+	{"GL_NV_conservative_raster_dilate", &GLAD_GL_NV_conservative_raster_dilate, load_GL_NV_conservative_raster_dilate},
+	{"GL_NV_copy_depth_to_color", &GLAD_GL_NV_copy_depth_to_color, NULL},
+	{"GL_NV_copy_image", &GLAD_GL_NV_copy_image, load_GL_NV_copy_image},
+	{"GL_NV_deep_texture3D", &GLAD_GL_NV_deep_texture3D, NULL},
+	{"GL_NV_depth_buffer_float", &GLAD_GL_NV_depth_buffer_float, load_GL_NV_depth_buffer_float},
+	{"GL_NV_depth_clamp", &GLAD_GL_NV_depth_clamp, NULL},
+	{"GL_NV_draw_texture", &GLAD_GL_NV_draw_texture, load_GL_NV_draw_texture},
+	{"GL_NV_evaluators", &GLAD_GL_NV_evaluators, load_GL_NV_evaluators},
+	{"GL_NV_explicit_multisample", &GLAD_GL_NV_explicit_multisample, load_GL_NV_explicit_multisample},
+	{"GL_NV_fence", &GLAD_GL_NV_fence, load_GL_NV_fence},
+	{"GL_NV_fill_rectangle", &GLAD_GL_NV_fill_rectangle, NULL},
+	{"GL_NV_float_buffer", &GLAD_GL_NV_float_buffer, NULL},
+	{"GL_NV_fog_distance", &GLAD_GL_NV_fog_distance, NULL},
+	{"GL_NV_fragment_coverage_to_color", &GLAD_GL_NV_fragment_coverage_to_color, load_GL_NV_fragment_coverage_to_color},
+	{"GL_NV_fragment_program", &GLAD_GL_NV_fragment_program, load_GL_NV_fragment_program},
+	{"GL_NV_fragment_program2", &GLAD_GL_NV_fragment_program2, NULL},
+	{"GL_NV_fragment_program4", &GLAD_GL_NV_fragment_program4, NULL},
+	{"GL_NV_fragment_program_option", &GLAD_GL_NV_fragment_program_option, NULL},
+	{"GL_NV_fragment_shader_interlock", &GLAD_GL_NV_fragment_shader_interlock, NULL},
+	{"GL_NV_framebuffer_mixed_samples", &GLAD_GL_NV_framebuffer_mixed_samples, load_GL_NV_framebuffer_mixed_samples},
+	{"GL_NV_framebuffer_multisample_coverage", &GLAD_GL_NV_framebuffer_multisample_coverage, load_GL_NV_framebuffer_multisample_coverage},
+	{"GL_NV_geometry_program4", &GLAD_GL_NV_geometry_program4, load_GL_NV_geometry_program4},
+	{"GL_NV_geometry_shader4", &GLAD_GL_NV_geometry_shader4, NULL},
+	{"GL_NV_geometry_shader_passthrough", &GLAD_GL_NV_geometry_shader_passthrough, NULL},
+	{"GL_NV_gpu_program4", &GLAD_GL_NV_gpu_program4, load_GL_NV_gpu_program4},
+	{"GL_NV_gpu_program5", &GLAD_GL_NV_gpu_program5, load_GL_NV_gpu_program5},
+	{"GL_NV_gpu_program5_mem_extended", &GLAD_GL_NV_gpu_program5_mem_extended, NULL},
+	{"GL_NV_gpu_shader5", &GLAD_GL_NV_gpu_shader5, load_GL_NV_gpu_shader5},
+	{"GL_NV_half_float", &GLAD_GL_NV_half_float, load_GL_NV_half_float},
+	{"GL_NV_internalformat_sample_query", &GLAD_GL_NV_internalformat_sample_query, load_GL_NV_internalformat_sample_query},
+	{"GL_NV_light_max_exponent", &GLAD_GL_NV_light_max_exponent, NULL},
+	{"GL_NV_multisample_coverage", &GLAD_GL_NV_multisample_coverage, NULL},
+	{"GL_NV_multisample_filter_hint", &GLAD_GL_NV_multisample_filter_hint, NULL},
+	{"GL_NV_occlusion_query", &GLAD_GL_NV_occlusion_query, load_GL_NV_occlusion_query},
+	{"GL_NV_packed_depth_stencil", &GLAD_GL_NV_packed_depth_stencil, NULL},
+	{"GL_NV_parameter_buffer_object", &GLAD_GL_NV_parameter_buffer_object, load_GL_NV_parameter_buffer_object},
+	{"GL_NV_parameter_buffer_object2", &GLAD_GL_NV_parameter_buffer_object2, NULL},
+	{"GL_NV_path_rendering", &GLAD_GL_NV_path_rendering, load_GL_NV_path_rendering},
+	{"GL_NV_path_rendering_shared_edge", &GLAD_GL_NV_path_rendering_shared_edge, NULL},
+	{"GL_NV_pixel_data_range", &GLAD_GL_NV_pixel_data_range, load_GL_NV_pixel_data_range},
+	{"GL_NV_point_sprite", &GLAD_GL_NV_point_sprite, load_GL_NV_point_sprite},
+	{"GL_NV_present_video", &GLAD_GL_NV_present_video, load_GL_NV_present_video},
+	{"GL_NV_primitive_restart", &GLAD_GL_NV_primitive_restart, load_GL_NV_primitive_restart},
+	{"GL_NV_register_combiners", &GLAD_GL_NV_register_combiners, load_GL_NV_register_combiners},
+	{"GL_NV_register_combiners2", &GLAD_GL_NV_register_combiners2, load_GL_NV_register_combiners2},
+	{"GL_NV_sample_locations", &GLAD_GL_NV_sample_locations, load_GL_NV_sample_locations},
+	{"GL_NV_sample_mask_override_coverage", &GLAD_GL_NV_sample_mask_override_coverage, NULL},
+	{"GL_NV_shader_atomic_counters", &GLAD_GL_NV_shader_atomic_counters, NULL},
+	{"GL_NV_shader_atomic_float", &GLAD_GL_NV_shader_atomic_float, NULL},
+	{"GL_NV_shader_atomic_fp16_vector", &GLAD_GL_NV_shader_atomic_fp16_vector, NULL},
+	{"GL_NV_shader_atomic_int64", &GLAD_GL_NV_shader_atomic_int64, NULL},
+	{"GL_NV_shader_buffer_load", &GLAD_GL_NV_shader_buffer_load, load_GL_NV_shader_buffer_load},
+	{"GL_NV_shader_buffer_store", &GLAD_GL_NV_shader_buffer_store, NULL},
+	{"GL_NV_shader_storage_buffer_object", &GLAD_GL_NV_shader_storage_buffer_object, NULL},
+	{"GL_NV_shader_thread_group", &GLAD_GL_NV_shader_thread_group, NULL},
+	{"GL_NV_shader_thread_shuffle", &GLAD_GL_NV_shader_thread_shuffle, NULL},
+	{"GL_NV_tessellation_program5", &GLAD_GL_NV_tessellation_program5, NULL},
+	{"GL_NV_texgen_emboss", &GLAD_GL_NV_texgen_emboss, NULL},
+	{"GL_NV_texgen_reflection", &GLAD_GL_NV_texgen_reflection, NULL},
+	{"GL_NV_texture_barrier", &GLAD_GL_NV_texture_barrier, load_GL_NV_texture_barrier},
+	{"GL_NV_texture_compression_vtc", &GLAD_GL_NV_texture_compression_vtc, NULL},
+	{"GL_NV_texture_env_combine4", &GLAD_GL_NV_texture_env_combine4, NULL},
+	{"GL_NV_texture_expand_normal", &GLAD_GL_NV_texture_expand_normal, NULL},
+	{"GL_NV_texture_multisample", &GLAD_GL_NV_texture_multisample, load_GL_NV_texture_multisample},
+	{"GL_NV_texture_rectangle", &GLAD_GL_NV_texture_rectangle, NULL},
+	{"GL_NV_texture_shader", &GLAD_GL_NV_texture_shader, NULL},
+	{"GL_NV_texture_shader2", &GLAD_GL_NV_texture_shader2, NULL},
+	{"GL_NV_texture_shader3", &GLAD_GL_NV_texture_shader3, NULL},
+	{"GL_NV_transform_feedback", &GLAD_GL_NV_transform_feedback, load_GL_NV_transform_feedback},
+	{"GL_NV_transform_feedback2", &GLAD_GL_NV_transform_feedback2, load_GL_NV_transform_feedback2},
+	{"GL_NV_uniform_buffer_unified_memory", &GLAD_GL_NV_uniform_buffer_unified_memory, NULL},
+	{"GL_NV_vdpau_interop", &GLAD_GL_NV_vdpau_interop, load_GL_NV_vdpau_interop},
+	{"GL_NV_vertex_array_range", &GLAD_GL_NV_vertex_array_range, load_GL_NV_vertex_array_range},
+	{"GL_NV_vertex_array_range2", &GLAD_GL_NV_vertex_array_range2, NULL},
+	{"GL_NV_vertex_attrib_integer_64bit", &GLAD_GL_NV_vertex_attrib_integer_64bit, load_GL_NV_vertex_attrib_integer_64bit},
+	{"GL_NV_vertex_buffer_unified_memory", &GLAD_GL_NV_vertex_buffer_unified_memory, load_GL_NV_vertex_buffer_unified_memory},
+	{"GL_NV_vertex_program", &GLAD_GL_NV_vertex_program, load_GL_NV_vertex_program},
+	{"GL_NV_vertex_program1_1", &GLAD_GL_NV_vertex_program1_1, NULL},
+	{"GL_NV_vertex_program2", &GLAD_GL_NV_vertex_program2, NULL},
+	{"GL_NV_vertex_program2_option", &GLAD_GL_NV_vertex_program2_option, NULL},
+	{"GL_NV_vertex_program3", &GLAD_GL_NV_vertex_program3, NULL},
+	{"GL_NV_vertex_program4", &GLAD_GL_NV_vertex_program4, load_GL_NV_vertex_program4},
+	{"GL_NV_video_capture", &GLAD_GL_NV_video_capture, load_GL_NV_video_capture},
+	{"GL_NV_viewport_array2", &GLAD_GL_NV_viewport_array2, NULL},
+	{"GL_OES_byte_coordinates", &GLAD_GL_OES_byte_coordinates, load_GL_OES_byte_coordinates},
+	{"GL_OES_compressed_paletted_texture", &GLAD_GL_OES_compressed_paletted_texture, NULL},
+	{"GL_OES_fixed_point", &GLAD_GL_OES_fixed_point, load_GL_OES_fixed_point},
+	{"GL_OES_query_matrix", &GLAD_GL_OES_query_matrix, load_GL_OES_query_matrix},
+	{"GL_OES_read_format", &GLAD_GL_OES_read_format, NULL},
+	{"GL_OES_single_precision", &GLAD_GL_OES_single_precision, load_GL_OES_single_precision},
+	{"GL_OML_interlace", &GLAD_GL_OML_interlace, NULL},
+	{"GL_OML_resample", &GLAD_GL_OML_resample, NULL},
+	{"GL_OML_subsample", &GLAD_GL_OML_subsample, NULL},
+	{"GL_OVR_multiview", &GLAD_GL_OVR_multiview, load_GL_OVR_multiview},
+	{"GL_OVR_multiview2", &GLAD_GL_OVR_multiview2, NULL},
+	{"GL_PGI_misc_hints", &GLAD_GL_PGI_misc_hints, load_GL_PGI_misc_hints},
+	{"GL_PGI_vertex_hints", &GLAD_GL_PGI_vertex_hints, NULL},
+	{"GL_REND_screen_coordinates", &GLAD_GL_REND_screen_coordinates, NULL},
+	{"GL_S3_s3tc", &GLAD_GL_S3_s3tc, NULL},
+	{"GL_SGIS_detail_texture", &GLAD_GL_SGIS_detail_texture, load_GL_SGIS_detail_texture},
+	{"GL_SGIS_fog_function", &GLAD_GL_SGIS_fog_function, load_GL_SGIS_fog_function},
+	{"GL_SGIS_generate_mipmap", &GLAD_GL_SGIS_generate_mipmap, NULL},
+	{"GL_SGIS_multisample", &GLAD_GL_SGIS_multisample, load_GL_SGIS_multisample},
+	{"GL_SGIS_pixel_texture", &GLAD_GL_SGIS_pixel_texture, load_GL_SGIS_pixel_texture},
+	{"GL_SGIS_point_line_texgen", &GLAD_GL_SGIS_point_line_texgen, NULL},
+	{"GL_SGIS_point_parameters", &GLAD_GL_SGIS_point_parameters, load_GL_SGIS_point_parameters},
+	{"GL_SGIS_sharpen_texture", &GLAD_GL_SGIS_sharpen_texture, load_GL_SGIS_sharpen_texture},
+	{"GL_SGIS_texture4D", &GLAD_GL_SGIS_texture4D, load_GL_SGIS_texture4D},
+	{"GL_SGIS_texture_border_clamp", &GLAD_GL_SGIS_texture_border_clamp, NULL},
+	{"GL_SGIS_texture_color_mask", &GLAD_GL_SGIS_texture_color_mask, load_GL_SGIS_texture_color_mask},
+	{"GL_SGIS_texture_edge_clamp", &GLAD_GL_SGIS_texture_edge_clamp, NULL},
+	{"GL_SGIS_texture_filter4", &GLAD_GL_SGIS_texture_filter4, load_GL_SGIS_texture_filter4},
+	{"GL_SGIS_texture_lod", &GLAD_GL_SGIS_texture_lod, NULL},
+	{"GL_SGIS_texture_select", &GLAD_GL_SGIS_texture_select, NULL},
+	{"GL_SGIX_async", &GLAD_GL_SGIX_async, load_GL_SGIX_async},
+	{"GL_SGIX_async_histogram", &GLAD_GL_SGIX_async_histogram, NULL},
+	{"GL_SGIX_async_pixel", &GLAD_GL_SGIX_async_pixel, NULL},
+	{"GL_SGIX_blend_alpha_minmax", &GLAD_GL_SGIX_blend_alpha_minmax, NULL},
+	{"GL_SGIX_calligraphic_fragment", &GLAD_GL_SGIX_calligraphic_fragment, NULL},
+	{"GL_SGIX_clipmap", &GLAD_GL_SGIX_clipmap, NULL},
+	{"GL_SGIX_convolution_accuracy", &GLAD_GL_SGIX_convolution_accuracy, NULL},
+	{"GL_SGIX_depth_pass_instrument", &GLAD_GL_SGIX_depth_pass_instrument, NULL},
+	{"GL_SGIX_depth_texture", &GLAD_GL_SGIX_depth_texture, NULL},
+	{"GL_SGIX_flush_raster", &GLAD_GL_SGIX_flush_raster, load_GL_SGIX_flush_raster},
+	{"GL_SGIX_fog_offset", &GLAD_GL_SGIX_fog_offset, NULL},
+	{"GL_SGIX_fragment_lighting", &GLAD_GL_SGIX_fragment_lighting, load_GL_SGIX_fragment_lighting},
+	{"GL_SGIX_framezoom", &GLAD_GL_SGIX_framezoom, load_GL_SGIX_framezoom},
+	{"GL_SGIX_igloo_interface", &GLAD_GL_SGIX_igloo_interface, load_GL_SGIX_igloo_interface},
+	{"GL_SGIX_instruments", &GLAD_GL_SGIX_instruments, load_GL_SGIX_instruments},
+	{"GL_SGIX_interlace", &GLAD_GL_SGIX_interlace, NULL},
+	{"GL_SGIX_ir_instrument1", &GLAD_GL_SGIX_ir_instrument1, NULL},
+	{"GL_SGIX_list_priority", &GLAD_GL_SGIX_list_priority, load_GL_SGIX_list_priority},
+	{"GL_SGIX_pixel_texture", &GLAD_GL_SGIX_pixel_texture, load_GL_SGIX_pixel_texture},
+	{"GL_SGIX_pixel_tiles", &GLAD_GL_SGIX_pixel_tiles, NULL},
+	{"GL_SGIX_polynomial_ffd", &GLAD_GL_SGIX_polynomial_ffd, load_GL_SGIX_polynomial_ffd},
+	{"GL_SGIX_reference_plane", &GLAD_GL_SGIX_reference_plane, load_GL_SGIX_reference_plane},
+	{"GL_SGIX_resample", &GLAD_GL_SGIX_resample, NULL},
+	{"GL_SGIX_scalebias_hint", &GLAD_GL_SGIX_scalebias_hint, NULL},
+	{"GL_SGIX_shadow", &GLAD_GL_SGIX_shadow, NULL},
+	{"GL_SGIX_shadow_ambient", &GLAD_GL_SGIX_shadow_ambient, NULL},
+	{"GL_SGIX_sprite", &GLAD_GL_SGIX_sprite, load_GL_SGIX_sprite},
+	{"GL_SGIX_subsample", &GLAD_GL_SGIX_subsample, NULL},
+	{"GL_SGIX_tag_sample_buffer", &GLAD_GL_SGIX_tag_sample_buffer, load_GL_SGIX_tag_sample_buffer},
+	{"GL_SGIX_texture_add_env", &GLAD_GL_SGIX_texture_add_env, NULL},
+	{"GL_SGIX_texture_coordinate_clamp", &GLAD_GL_SGIX_texture_coordinate_clamp, NULL},
+	{"GL_SGIX_texture_lod_bias", &GLAD_GL_SGIX_texture_lod_bias, NULL},
+	{"GL_SGIX_texture_multi_buffer", &GLAD_GL_SGIX_texture_multi_buffer, NULL},
+	{"GL_SGIX_texture_scale_bias", &GLAD_GL_SGIX_texture_scale_bias, NULL},
+	{"GL_SGIX_vertex_preclip", &GLAD_GL_SGIX_vertex_preclip, NULL},
+	{"GL_SGIX_ycrcb", &GLAD_GL_SGIX_ycrcb, NULL},
+	{"GL_SGIX_ycrcb_subsample", &GLAD_GL_SGIX_ycrcb_subsample, NULL},
+	{"GL_SGIX_ycrcba", &GLAD_GL_SGIX_ycrcba, NULL},
+	{"GL_SGI_color_matrix", &GLAD_GL_SGI_color_matrix, NULL},
+	{"GL_SGI_color_table", &GLAD_GL_SGI_color_table, load_GL_SGI_color_table},
+	{"GL_SGI_texture_color_table", &GLAD_GL_SGI_texture_color_table, NULL},
+	{"GL_SUNX_constant_data", &GLAD_GL_SUNX_constant_data, load_GL_SUNX_constant_data},
+	{"GL_SUN_convolution_border_modes", &GLAD_GL_SUN_convolution_border_modes, NULL},
+	{"GL_SUN_global_alpha", &GLAD_GL_SUN_global_alpha, load_GL_SUN_global_alpha},
+	{"GL_SUN_mesh_array", &GLAD_GL_SUN_mesh_array, load_GL_SUN_mesh_array},
+	{"GL_SUN_slice_accum", &GLAD_GL_SUN_slice_accum, NULL},
+	{"GL_SUN_triangle_list", &GLAD_GL_SUN_triangle_list, load_GL_SUN_triangle_list},
+	{"GL_SUN_vertex", &GLAD_GL_SUN_vertex, load_GL_SUN_vertex},
+	{"GL_WIN_phong_shading", &GLAD_GL_WIN_phong_shading, NULL},
+	{"GL_WIN_specular_fog", &GLAD_GL_WIN_specular_fog, NULL},
+};
+
+#define NUM_EXTENSIONS_GL ((int)(sizeof(extensionsGL) / sizeof(extensionsGL[0])))
+
+#ifdef GLAD_TRIMMED
+/* Trimmed mode: only these extensions are looked up at load time, on top of
+ * core 3.3. Everything else stays 0/NULL until gladLoadGLExtension() asks for
+ * it, so startup doesn't pay a lookup and hundreds of dlsym calls for vendor
+ * extensions the program never touches. */
+static const char *eager_extensionsGL[] = {
+    "GL_ARB_get_program_binary",
+    NULL
+};
+
+static unsigned char resolved_extensionsGL[NUM_EXTENSIONS_GL];
+static GLADloadproc lazy_load = NULL;
+#endif
+
+static void load_extensionGL(int i, GLADloadproc load) {
+    *extensionsGL[i].flag = has_ext(extensionsGL[i].name);
+    if (*extensionsGL[i].flag && extensionsGL[i].loader != NULL)
+        extensionsGL[i].loader(load);
+}
+
+static int find_extensionGL(const char *ext) {
+    int lo = 0, hi = NUM_EXTENSIONS_GL - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(ext, extensionsGL[mid].name);
+        if (cmp == 0) return mid;
+        if (cmp < 0) hi = mid - 1;
+        else lo = mid + 1;
+    }
+    return -1;
+}
+
+static int find_extensionsGL(GLADloadproc load) {
+    int i;
+    if (!get_exts()) return 0;
+#ifdef GLAD_TRIMMED
+    for (i = 0; i < NUM_EXTENSIONS_GL; i++) {
+        *extensionsGL[i].flag = 0;
+        resolved_extensionsGL[i] = 0;
+    }
+    for (i = 0; eager_extensionsGL[i] != NULL; i++) {
+        int e = find_extensionGL(eager_extensionsGL[i]);
+        if (e < 0) continue;
+        load_extensionGL(e, load);
+        resolved_extensionsGL[e] = 1;
+    }
+    /* the extension set is kept for gladLoadGLExtension() */
+    lazy_load = load;
+#else
+    for (i = 0; i < NUM_EXTENSIONS_GL; i++)
+        load_extensionGL(i, load);
+    free_exts();
+#endif
+    return 1;
+}
+
+/* Sets the GLAD_GL_* flag for one extension and resolves its entry points.
+ * Returns the flag. In trimmed mode this is how extensions outside the
+ * allow-list get loaded, once, on first request; it needs the context that
+ * was current for gladLoadGLLoader(). Otherwise everything was resolved up
+ * front and this just reads the flag. */
+#ifdef __cplusplus
+extern "C"
+#endif
+int gladLoadGLExtension(const char *ext);
+
+int gladLoadGLExtension(const char *ext) {
+    int e = find_extensionGL(ext);
+    if (e < 0) return 0;
+#ifdef GLAD_TRIMMED
+    if (!resolved_extensionsGL[e] && lazy_load != NULL) {
+        if (ext_set == NULL && !get_exts()) return 0;
+        load_extensionGL(e, lazy_load);
+        resolved_extensionsGL[e] = 1;
+    }
+#endif
+    return *extensionsGL[e].flag;
 }
 
 static void find_coreGL(void) {
@@ -7515,279 +7647,7 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_2(load);
 	load_GL_VERSION_3_3(load);
 
-	if (!find_extensionsGL()) return 0;
-	load_GL_3DFX_tbuffer(load);
-	load_GL_AMD_debug_output(load);
-	load_GL_AMD_draw_buffers_blend(load);
-	load_GL_AMD_gpu_shader_int64(load);
-	load_GL_AMD_interleaved_elements(load);
-	load_GL_AMD_multi_draw_indirect(load);
-	load_GL_AMD_name_gen_delete(load);
-	load_GL_AMD_occlusion_query_event(load);
-	load_GL_AMD_performance_monitor(load);
-	load_GL_AMD_sample_positions(load);
-	load_GL_AMD_sparse_texture(load);
-	load_GL_AMD_stencil_operation_extended(load);
-	load_GL_AMD_vertex_shader_tessellator(load);
-	load_GL_APPLE_element_array(load);
-	load_GL_APPLE_fence(load);
-	load_GL_APPLE_flush_buffer_range(load);
-	load_GL_APPLE_object_purgeable(load);
-	load_GL_APPLE_texture_range(load);
-	load_GL_APPLE_vertex_array_object(load);
-	load_GL_APPLE_vertex_array_range(load);
-	load_GL_APPLE_vertex_program_evaluators(load);
-	load_GL_ARB_ES2_compatibility(load);
-	load_GL_ARB_ES3_1_compatibility(load);
-	load_GL_ARB_ES3_2_compatibility(load);
-	load_GL_ARB_base_instance(load);
-	load_GL_ARB_bindless_texture(load);
-	load_GL_ARB_blend_func_extended(load);
-	load_GL_ARB_buffer_storage(load);
-	load_GL_ARB_cl_event(load);
-	load_GL_ARB_clear_buffer_object(load);
-	load_GL_ARB_clear_texture(load);
-	load_GL_ARB_clip_control(load);
-	load_GL_ARB_color_buffer_float(load);
-	load_GL_ARB_compute_shader(load);
-	load_GL_ARB_compute_variable_group_size(load);
-	load_GL_ARB_copy_buffer(load);
-	load_GL_ARB_copy_image(load);
-	load_GL_ARB_debug_output(load);
-	load_GL_ARB_direct_state_access(load);
-	load_GL_ARB_draw_buffers(load);
-	load_GL_ARB_draw_buffers_blend(load);
-	load_GL_ARB_draw_elements_base_vertex(load);
-	load_GL_ARB_draw_indirect(load);
-	load_GL_ARB_draw_instanced(load);
-	load_GL_ARB_fragment_program(load);
-	load_GL_ARB_framebuffer_no_attachments(load);
-	load_GL_ARB_framebuffer_object(load);
-	load_GL_ARB_geometry_shader4(load);
-	load_GL_ARB_get_program_binary(load);
-	load_GL_ARB_get_texture_sub_image(load);
-	load_GL_ARB_gpu_shader_fp64(load);
-	load_GL_ARB_gpu_shader_int64(load);
-	load_GL_ARB_imaging(load);
-	load_GL_ARB_indirect_parameters(load);
-	load_GL_ARB_instanced_arrays(load);
-	load_GL_ARB_internalformat_query(load);
-	load_GL_ARB_internalformat_query2(load);
-	load_GL_ARB_invalidate_subdata(load);
-	load_GL_ARB_map_buffer_range(load);
-	load_GL_ARB_matrix_palette(load);
-	load_GL_ARB_multi_bind(load);
-	load_GL_ARB_multi_draw_indirect(load);
-	load_GL_ARB_multisample(load);
-	load_GL_ARB_multitexture(load);
-	load_GL_ARB_occlusion_query(load);
-	load_GL_ARB_parallel_shader_compile(load);
-	load_GL_ARB_point_parameters(load);
-	load_GL_ARB_program_interface_query(load);
-	load_GL_ARB_provoking_vertex(load);
-	load_GL_ARB_robustness(load);
-	load_GL_ARB_sample_locations(load);
-	load_GL_ARB_sample_shading(load);
-	load_GL_ARB_sampler_objects(load);
-	load_GL_ARB_separate_shader_objects(load);
-	load_GL_ARB_shader_atomic_counters(load);
-	load_GL_ARB_shader_image_load_store(load);
-	load_GL_ARB_shader_objects(load);
-	load_GL_ARB_shader_storage_buffer_object(load);
-	load_GL_ARB_shader_subroutine(load);
-	load_GL_ARB_shading_language_include(load);
-	load_GL_ARB_sparse_buffer(load);
-	load_GL_ARB_sparse_texture(load);
-	load_GL_ARB_sync(load);
-	load_GL_ARB_tessellation_shader(load);
-	load_GL_ARB_texture_barrier(load);
-	load_GL_ARB_texture_buffer_object(load);
-	load_GL_ARB_texture_buffer_range(load);
-	load_GL_ARB_texture_compression(load);
-	load_GL_ARB_texture_multisample(load);
-	load_GL_ARB_texture_storage(load);
-	load_GL_ARB_texture_storage_multisample(load);
-	load_GL_ARB_texture_view(load);
-	load_GL_ARB_timer_query(load);
-	load_GL_ARB_transform_feedback2(load);
-	load_GL_ARB_transform_feedback3(load);
-	load_GL_ARB_transform_feedback_instanced(load);
-	load_GL_ARB_transpose_matrix(load);
-	load_GL_ARB_uniform_buffer_object(load);
-	load_GL_ARB_vertex_array_object(load);
-	load_GL_ARB_vertex_attrib_64bit(load);
-	load_GL_ARB_vertex_attrib_binding(load);
-	load_GL_ARB_vertex_blend(load);
-	load_GL_ARB_vertex_buffer_object(load);
-	load_GL_ARB_vertex_program(load);
-	load_GL_ARB_vertex_shader(load);
-	load_GL_ARB_vertex_type_2_10_10_10_rev(load);
-	load_GL_ARB_viewport_array(load);
-	load_GL_ARB_window_pos(load);
-	load_GL_ATI_draw_buffers(load);
-	load_GL_ATI_element_array(load);
-	load_GL_ATI_envmap_bumpmap(load);
-	load_GL_ATI_fragment_shader(load);
-	load_GL_ATI_map_object_buffer(load);
-	load_GL_ATI_pn_triangles(load);
-	load_GL_ATI_separate_stencil(load);
-	load_GL_ATI_vertex_array_object(load);
-	load_GL_ATI_vertex_attrib_array_object(load);
-	load_GL_ATI_vertex_streams(load);
-	load_GL_EXT_bindable_uniform(load);
-	load_GL_EXT_blend_color(load);
-	load_GL_EXT_blend_equation_separate(load);
-	load_GL_EXT_blend_func_separate(load);
-	load_GL_EXT_blend_minmax(load);
-	load_GL_EXT_color_subtable(load);
-	load_GL_EXT_compiled_vertex_array(load);
-	load_GL_EXT_convolution(load);
-	load_GL_EXT_coordinate_frame(load);
-	load_GL_EXT_copy_texture(load);
-	load_GL_EXT_cull_vertex(load);
-	load_GL_EXT_debug_label(load);
-	load_GL_EXT_debug_marker(load);
-	load_GL_EXT_depth_bounds_test(load);
-	load_GL_EXT_direct_state_access(load);
-	load_GL_EXT_draw_buffers2(load);
-	load_GL_EXT_draw_instanced(load);
-	load_GL_EXT_draw_range_elements(load);
-	load_GL_EXT_fog_coord(load);
-	load_GL_EXT_framebuffer_blit(load);
-	load_GL_EXT_framebuffer_multisample(load);
-	load_GL_EXT_framebuffer_object(load);
-	load_GL_EXT_geometry_shader4(load);
-	load_GL_EXT_gpu_program_parameters(load);
-	load_GL_EXT_gpu_shader4(load);
-	load_GL_EXT_histogram(load);
-	load_GL_EXT_index_func(load);
-	load_GL_EXT_index_material(load);
-	load_GL_EXT_light_texture(load);
-	load_GL_EXT_multi_draw_arrays(load);
-	load_GL_EXT_multisample(load);
-	load_GL_EXT_paletted_texture(load);
-	load_GL_EXT_pixel_transform(load);
-	load_GL_EXT_point_parameters(load);
-	load_GL_EXT_polygon_offset(load);
-	load_GL_EXT_polygon_offset_clamp(load);
-	load_GL_EXT_provoking_vertex(load);
-	load_GL_EXT_raster_multisample(load);
-	load_GL_EXT_secondary_color(load);
-	load_GL_EXT_separate_shader_objects(load);
-	load_GL_EXT_shader_image_load_store(load);
-	load_GL_EXT_stencil_clear_tag(load);
-	load_GL_EXT_stencil_two_side(load);
-	load_GL_EXT_subtexture(load);
-	load_GL_EXT_texture3D(load);
-	load_GL_EXT_texture_array(load);
-	load_GL_EXT_texture_buffer_object(load);
-	load_GL_EXT_texture_filter_minmax(load);
-	load_GL_EXT_texture_integer(load);
-	load_GL_EXT_texture_object(load);
-	load_GL_EXT_texture_perturb_normal(load);
-	load_GL_EXT_timer_query(load);
-	load_GL_EXT_transform_feedback(load);
-	load_GL_EXT_vertex_array(load);
-	load_GL_EXT_vertex_attrib_64bit(load);
-	load_GL_EXT_vertex_shader(load);
-	load_GL_EXT_vertex_weighting(load);
-	load_GL_EXT_x11_sync_object(load);
-	load_GL_GREMEDY_frame_terminator(load);
-	load_GL_GREMEDY_string_marker(load);
-	load_GL_HP_image_transform(load);
-	load_GL_IBM_multimode_draw_arrays(load);
-	load_GL_IBM_static_data(load);
-	load_GL_IBM_vertex_array_lists(load);
-	load_GL_INGR_blend_func_separate(load);
-	load_GL_INTEL_framebuffer_CMAA(load);
-	load_GL_INTEL_map_texture(load);
-	load_GL_INTEL_parallel_arrays(load);
-	load_GL_INTEL_performance_query(load);
-	load_GL_KHR_blend_equation_advanced(load);
-	load_GL_KHR_debug(load);
-	load_GL_KHR_robustness(load);
-	load_GL_MESA_resize_buffers(load);
-	load_GL_MESA_window_pos(load);
-	load_GL_NVX_conditional_render(load);
-	load_GL_NV_bindless_multi_draw_indirect(load);
-	load_GL_NV_bindless_multi_draw_indirect_count(load);
-	load_GL_NV_bindless_texture(load);
-	load_GL_NV_blend_equation_advanced(load);
-	load_GL_NV_command_list(load);
-	load_GL_NV_conditional_render(load);
-	load_GL_NV_conservative_raster(load);
-	load_GL_NV_conservative_raster_dilate(load);
-	load_GL_NV_copy_image(load);
-	load_GL_NV_depth_buffer_float(load);
-	load_GL_NV_draw_texture(load);
-	load_GL_NV_evaluators(load);
-	load_GL_NV_explicit_multisample(load);
-	load_GL_NV_fence(load);
-	load_GL_NV_fragment_coverage_to_color(load);
-	load_GL_NV_fragment_program(load);
-	load_GL_NV_framebuffer_mixed_samples(load);
-	load_GL_NV_framebuffer_multisample_coverage(load);
-	load_GL_NV_geometry_program4(load);
-	load_GL_NV_gpu_program4(load);
-	load_GL_NV_gpu_program5(load);
-	load_GL_NV_gpu_shader5(load);
-	load_GL_NV_half_float(load);
-	load_GL_NV_internalformat_sample_query(load);
-	load_GL_NV_occlusion_query(load);
-	load_GL_NV_parameter_buffer_object(load);
-	load_GL_NV_path_rendering(load);
-	load_GL_NV_pixel_data_range(load);
-	load_GL_NV_point_sprite(load);
-	load_GL_NV_present_video(load);
-	load_GL_NV_primitive_restart(load);
-	load_GL_NV_register_combiners(load);
-	load_GL_NV_register_combiners2(load);
-	load_GL_NV_sample_locations(load);
-	load_GL_NV_shader_buffer_load(load);
-	load_GL_NV_texture_barrier(load);
-	load_GL_NV_texture_multisample(load);
-	load_GL_NV_transform_feedback(load);
-	load_GL_NV_transform_feedback2(load);
-	load_GL_NV_vdpau_interop(load);
-	load_GL_NV_vertex_array_range(load);
-	load_GL_NV_vertex_attrib_integer_64bit(load);
-	load_GL_NV_vertex_buffer_unified_memory(load);
-	load_GL_NV_vertex_program(load);
-	load_GL_NV_vertex_program4(load);
-	load_GL_NV_video_capture(load);
-	load_GL_OES_byte_coordinates(load);
-	load_GL_OES_fixed_point(load);
-	load_GL_OES_query_matrix(load);
-	load_GL_OES_single_precision(load);
-	load_GL_OVR_multiview(load);
-	load_GL_PGI_misc_hints(load);
-	load_GL_SGIS_detail_texture(load);
-	load_GL_SGIS_fog_function(load);
-	load_GL_SGIS_multisample(load);
-	load_GL_SGIS_pixel_texture(load);
-	load_GL_SGIS_point_parameters(load);
-	load_GL_SGIS_sharpen_texture(load);
-	load_GL_SGIS_texture4D(load);
-	load_GL_SGIS_texture_color_mask(load);
-	load_GL_SGIS_texture_filter4(load);
-	load_GL_SGIX_async(load);
-	load_GL_SGIX_flush_raster(load);
-	load_GL_SGIX_fragment_lighting(load);
-	load_GL_SGIX_framezoom(load);
-	load_GL_SGIX_igloo_interface(load);
-	load_GL_SGIX_instruments(load);
-	load_GL_SGIX_list_priority(load);
-	load_GL_SGIX_pixel_texture(load);
-	load_GL_SGIX_polynomial_ffd(load);
-	load_GL_SGIX_reference_plane(load);
-	load_GL_SGIX_sprite(load);
-	load_GL_SGIX_tag_sample_buffer(load);
-	load_GL_SGI_color_table(load);
-	load_GL_SUNX_constant_data(load);
-	load_GL_SUN_global_alpha(load);
-	load_GL_SUN_mesh_array(load);
-	load_GL_SUN_triangle_list(load);
-	load_GL_SUN_vertex(load);
+	if (!find_extensionsGL(load)) return 0;
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 